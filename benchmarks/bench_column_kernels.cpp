@@ -0,0 +1,94 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "../src/column_filter.h"
+
+namespace
+{
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    using Kernel = void (*)(const ColumnFilter::FieldPredicate &, const TaskStore::Columns &,
+                            size_t, size_t, uint64_t *);
+
+    // Scans the whole store block by block, as TaskManager does; returns matches
+    size_t scan(Kernel kernel, const ColumnFilter::FieldPredicate &fields, const TaskStore::Columns &columns)
+    {
+        uint64_t selection[ColumnFilter::BLOCK_SLOTS / 64];
+        size_t matches = 0;
+        for (size_t begin = 0; begin < columns.id.size(); begin += ColumnFilter::BLOCK_SLOTS)
+        {
+            size_t end = std::min(columns.id.size(), begin + ColumnFilter::BLOCK_SLOTS);
+            kernel(fields, columns, begin, end, selection);
+            for (size_t w = 0; w < (end - begin + 63) / 64; ++w)
+            {
+                matches += static_cast<size_t>(__builtin_popcountll(selection[w]));
+            }
+        }
+        return matches;
+    }
+}
+
+// Usage: bench_column_kernels [task_count] [repeats]   (default: 10,000,000 and 5)
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    int repeats = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < count; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        int32_t due = (seed >> 8) % 10 == 0 ? INT32_MIN : static_cast<int32_t>(19000 + (seed >> 10) % 3650);
+        tasks.emplace_back(static_cast<int>(i + 1), std::string(), static_cast<TaskStatus>((seed >> 4) % 3),
+                           static_cast<TaskPriority>((seed >> 6) % 3), due, 19000);
+    }
+    TaskStore store;
+    store.assign(std::move(tasks));
+    TaskStore::Columns columns = store.columns();
+
+    // status == pending AND priority == high AND due within the next week
+    FilterUtils::TaskPredicate predicate = FilterUtils::compileCriteria(QueryContext{20500}, "", "high", "pending");
+    ColumnFilter::FieldPredicate fields = ColumnFilter::lower(predicate);
+    fields.check_due = true;
+    fields.due_first = 20500;
+    fields.due_last = 20507;
+
+    std::cout << count << " tasks, pending + high + due within 7 days" << std::endl;
+    size_t scalarMatches = 0;
+    double scalarMs = 1e30;
+    for (int i = 0; i < repeats; ++i)
+    {
+        scalarMs = std::min(scalarMs, timeMs([&]
+                                             { scalarMatches = scan(ColumnFilter::selectScalar, fields, columns); }));
+    }
+    std::cout << "  scalar: " << scalarMs << " ms, " << count / scalarMs / 1000.0 << " M tasks/s ("
+              << scalarMatches << " matches)" << std::endl;
+
+    if (!ColumnFilter::hasAvx2())
+    {
+        std::cout << "  avx2:   not supported on this CPU" << std::endl;
+        return 0;
+    }
+
+    size_t simdMatches = 0;
+    double simdMs = 1e30;
+    for (int i = 0; i < repeats; ++i)
+    {
+        simdMs = std::min(simdMs, timeMs([&]
+                                         { simdMatches = scan(ColumnFilter::selectAvx2, fields, columns); }));
+    }
+    std::cout << "  avx2:   " << simdMs << " ms, " << count / simdMs / 1000.0 << " M tasks/s ("
+              << simdMatches << " matches)" << std::endl;
+    return simdMatches == scalarMatches ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "../src/task_store.h"
+#include "../src/filter_utils.h"
+
+namespace
+{
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    size_t rowScan(const TaskStore &store, const FilterUtils::TaskPredicate &predicate)
+    {
+        size_t matches = 0;
+        store.forEach([&](const Task &task)
+                      { matches += predicate.matches(task) ? 1 : 0; });
+        return matches;
+    }
+
+    size_t columnScan(const TaskStore &store, const FilterUtils::TaskPredicate &predicate)
+    {
+        size_t matches = 0;
+        TaskStore::Columns columns = store.columns();
+        for (size_t slot = 0; slot < columns.id.size(); ++slot)
+        {
+            if (columns.id[slot] == 0 ||
+                !predicate.matchesFields(columns.status[slot], columns.priority[slot], columns.dueDay[slot]))
+                continue;
+            if (!predicate.keyword_lower.empty() &&
+                store.descriptionLower(slot).find(predicate.keyword_lower) == std::string_view::npos)
+                continue;
+            matches++;
+        }
+        return matches;
+    }
+}
+
+// Usage: bench_column_scan [task_count]   (default: 1,000,000)
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    const char *words[] = {"Review", "write", "Deploy", "fix", "plan", "meeting", "report", "invoice"};
+    TaskStore store;
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < count; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        std::string description = std::string(words[seed % 8]) + " the quarterly " + words[(seed >> 3) % 8] +
+                                  " for client #" + std::to_string(i);
+        tasks.emplace_back(static_cast<int>(i + 1), std::move(description), static_cast<TaskStatus>((seed >> 6) % 3),
+                           static_cast<TaskPriority>((seed >> 8) % 3), static_cast<int32_t>(19000 + (seed >> 10) % 3650), 19000);
+    }
+    store.assign(std::move(tasks));
+
+    QueryContext context{20500};
+    struct Query
+    {
+        const char *name;
+        FilterUtils::TaskPredicate predicate;
+    };
+    Query queries[] = {
+        {"status=pending", FilterUtils::compileCriteria(context, "", "", "pending")},
+        {"pending+high+overdue", FilterUtils::compileCriteria(context, "", "high", "pending", "", true)},
+        {"keyword \"deploy\"", FilterUtils::compileCriteria(context, "deploy")},
+    };
+
+    // The columns mirror the rows rather than replacing them
+    size_t rowBytes = 0;
+    store.forEach([&rowBytes](const Task &task)
+                  {
+        const std::string &description = task.getDescription();
+        rowBytes += sizeof(Task) + (description.capacity() > 15 ? description.capacity() + 1 : 0); });
+    size_t columnBytes = store.rows().size() * (3 * sizeof(int32_t) + sizeof(TaskStatus) + sizeof(TaskPriority) +
+                                                sizeof(uint64_t) + sizeof(uint32_t)) +
+                         store.descriptionTextBytes();
+
+    std::cout << count << " tasks" << std::endl;
+    std::cout << "  memory: rows " << rowBytes / (1024 * 1024) << " MiB, columns " << columnBytes / (1024 * 1024)
+              << " MiB (" << store.descriptionTextBytes() / (1024 * 1024) << " MiB of it lowercased text)" << std::endl;
+    bool agree = true;
+    for (const Query &query : queries)
+    {
+        size_t rowMatches = 0, columnMatches = 0;
+        double rowMs = timeMs([&]
+                              { rowMatches = rowScan(store, query.predicate); });
+        double columnMs = timeMs([&]
+                                 { columnMatches = columnScan(store, query.predicate); });
+        std::cout << "  " << query.name << ": rows " << rowMs << " ms, columns " << columnMs << " ms ("
+                  << columnMatches << " matches)" << std::endl;
+        agree = agree && rowMatches == columnMatches;
+    }
+    return agree ? 0 : 1;
+}
@@ -0,0 +1,27 @@
+#include <iostream>
+#include <cstdlib>
+#include "daemon_load.h"
+
+// Usage: bench_daemon_load [clients] [requests_per_client] [pipeline_depth] [task_count]
+//        (default: 1000 clients, 100 requests each, 1 in flight, 10,000 tasks)
+int main(int argc, char *argv[])
+{
+    DaemonLoad::Config config;
+    config.clients = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000;
+    config.perClient = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100;
+    config.depth = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1;
+    config.taskCount = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 10000;
+
+    DaemonLoad::Result result = DaemonLoad::run(config);
+    const std::vector<double> &latencies = result.latencies;
+
+    std::cout << "\n" << result.connected << " clients x " << config.perClient << " requests, " << config.depth
+              << " in flight each, " << config.taskCount << " tasks" << std::endl;
+    std::cout << "Completed " << latencies.size() << " requests in " << result.seconds * 1000.0 << " ms ("
+              << static_cast<double>(latencies.size()) / result.seconds << " req/s), "
+              << result.failures << " failed" << std::endl;
+    std::cout << "Latency p50 " << DaemonLoad::percentile(latencies, 0.50) << " us, p99 "
+              << DaemonLoad::percentile(latencies, 0.99) << " us, p999 " << DaemonLoad::percentile(latencies, 0.999)
+              << " us, max " << (latencies.empty() ? 0.0 : latencies.back()) << " us" << std::endl;
+    return result.failures == 0 ? 0 : 1;
+}
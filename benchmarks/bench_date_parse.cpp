@@ -0,0 +1,80 @@
+#include <iostream>
+#include <chrono>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdlib>
+#include "../src/date_utils.h"
+
+namespace
+{
+    // The original DateUtils::parseDateString + isValidDate, kept as the baseline
+    bool regexIsValidDate(const std::string &date_str)
+    {
+        std::regex date_regex(R"((\d{4})-(\d{2})-(\d{2}))");
+        std::smatch matches;
+        if (!std::regex_match(date_str, matches, date_regex))
+            return false;
+
+        int year = std::stoi(matches[1]);
+        int month = std::stoi(matches[2]);
+        int day = std::stoi(matches[3]);
+        return year >= 1900 && year <= 2100 && month >= 1 && month <= 12 && day >= 1 &&
+               day <= DateUtils::getDaysInMonth(month, year);
+    }
+
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+// Usage: bench_date_parse [date_count]   (default: 1,000,000)
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::vector<std::string> dates;
+    dates.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Every 16th date is malformed or out of range
+        dates.push_back(i % 16 == 0 ? "2025-02-30" : DateUtils::formatDayNumber(static_cast<int32_t>(19000 + i % 5000)));
+    }
+    std::vector<std::string_view> views(dates.begin(), dates.end());
+    std::vector<int32_t> days(count);
+
+    // The regex path is slow enough that a sample is plenty
+    size_t sample = std::min<size_t>(count, 100000);
+    size_t regexValid = 0;
+    double regexMs = timeMs([&]
+                            {
+        for (size_t i = 0; i < sample; ++i)
+            regexValid += regexIsValidDate(dates[i]); });
+
+    size_t scalarValid = 0;
+    double scalarMs = timeMs([&]
+                             {
+        for (const std::string &date : dates)
+            scalarValid += DateUtils::toDayNumber(date) != DateUtils::NO_DATE; });
+
+    size_t batchInvalid = 0;
+    double batchMs = timeMs([&]
+                            { batchInvalid = DateUtils::toDayNumbers(views, days); });
+
+    auto nsPerDate = [](double ms, size_t n)
+    { return ms * 1e6 / static_cast<double>(n); };
+
+    std::cout << "Regex parse:  " << nsPerDate(regexMs, sample) << " ns/date (" << sample << " dates)" << std::endl;
+    std::cout << "Scalar parse: " << nsPerDate(scalarMs, count) << " ns/date" << std::endl;
+    std::cout << "Batch column: " << nsPerDate(batchMs, count) << " ns/date" << std::endl;
+
+    bool agree = scalarValid + batchInvalid == count &&
+                 regexValid == sample - (sample + 15) / 16;
+    return agree ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "../src/filter_utils.h"
+#include "../src/date_utils.h"
+#include "../src/task.h"
+
+namespace
+{
+    // The pre-fusion implementation: one filter at a time, each producing a new vector
+    std::vector<Task> chainedFilter(const std::vector<Task> &tasks,
+                                    const std::string &keyword, const std::string &priority,
+                                    const std::string &status, bool overdue_only)
+    {
+        std::vector<Task> result = tasks;
+        result = FilterUtils::filterByKeyword(result, keyword);
+        result = FilterUtils::filterByPriority(result, priority);
+        result = FilterUtils::filterByStatus(result, status);
+        if (overdue_only)
+        {
+            result = FilterUtils::filterOverdue(result);
+        }
+        return result;
+    }
+
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+// Usage: bench_filter_criteria [task_count]   (default: 1,000,000)
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::cout << "Generating " << count << " tasks..." << std::endl;
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    const TaskPriority priorities[] = {TaskPriority::High, TaskPriority::Medium, TaskPriority::Low};
+    const TaskStatus statuses[] = {TaskStatus::Pending, TaskStatus::InProgress, TaskStatus::Done};
+    int32_t today = DateUtils::getCurrentDayNumber();
+    for (size_t i = 0; i < count; ++i)
+    {
+        int32_t due = (i % 5 == 0) ? DateUtils::NO_DATE : today + static_cast<int32_t>(i % 61) - 30;
+        tasks.emplace_back(static_cast<int>(i + 1),
+                           "Task number " + std::to_string(i) + (i % 7 == 0 ? " review report" : " write code"),
+                           statuses[i % 3], priorities[(i / 3) % 3], due, today - 60);
+    }
+
+    const std::string keyword = "report";
+    const std::string priority = "high";
+    const std::string status = "pending";
+
+    size_t chainedCount = 0;
+    double chainedMs = timeMs([&]
+                              { chainedCount = chainedFilter(tasks, keyword, priority, status, true).size(); });
+
+    size_t fusedCount = 0;
+    double fusedMs = timeMs([&]
+                            { fusedCount = FilterUtils::filterByCriteria(tasks, keyword, priority, status,
+                                                                         "", true, false).size(); });
+
+    size_t viewCount = 0;
+    TaskView all = FilterUtils::viewOf(tasks);
+    double viewMs = timeMs([&]
+                           { viewCount = FilterUtils::filterByCriteria(all, keyword, priority, status,
+                                                                       "", true, false).size(); });
+
+    std::cout << "Chained filters:        " << chainedMs << " ms (" << chainedCount << " matches)" << std::endl;
+    std::cout << "Fused (copying):        " << fusedMs << " ms (" << fusedCount << " matches)" << std::endl;
+    std::cout << "Fused (view):           " << viewMs << " ms (" << viewCount << " matches)" << std::endl;
+    std::cout << "Speedup (view/chained): " << chainedMs / viewMs << "x" << std::endl;
+
+    return chainedCount == fusedCount && fusedCount == viewCount ? 0 : 1;
+}
@@ -0,0 +1,46 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+#include "daemon_load.h"
+
+// Usage: bench_group_commit [clients] [mutations_per_client] [directory]
+//        (default: 64 clients, 50 mutations each, scratch store in the
+//        current directory so fsync reaches a real disk)
+//
+// Mutations per second against the commit window. A window of -1 fsyncs
+// every mutation on its own; 0 commits once per batch of ready events.
+int main(int argc, char *argv[])
+{
+    DaemonLoad::Config config;
+    config.clients = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 64;
+    config.perClient = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 50;
+    config.directory = argc > 3 ? argv[3] : ".";
+    config.taskCount = 1000;
+    config.writes = true;
+
+    const int WINDOWS[] = {-1, 0, 100, 500, 2000, 10000};
+    std::vector<std::string> rows;
+    for (int window : WINDOWS)
+    {
+        config.commitWindowMicros = window;
+        DaemonLoad::Result result = DaemonLoad::run(config);
+
+        std::ostringstream row;
+        row << std::setw(10) << window << std::setw(14) << std::fixed << std::setprecision(0)
+            << static_cast<double>(result.latencies.size()) / result.seconds
+            << std::setw(12) << DaemonLoad::percentile(result.latencies, 0.50)
+            << std::setw(12) << DaemonLoad::percentile(result.latencies, 0.99)
+            << (result.failures ? "  (" + std::to_string(result.failures) + " failed)" : "");
+        rows.push_back(row.str());
+    }
+
+    std::cout << "\n" << config.clients << " clients x " << config.perClient << " mutations" << std::endl;
+    std::cout << std::setw(10) << "window_us" << std::setw(14) << "mutations/s" << std::setw(12) << "p50_us"
+              << std::setw(12) << "p99_us" << std::endl;
+    for (const std::string &row : rows)
+    {
+        std::cout << row << std::endl;
+    }
+    return 0;
+}
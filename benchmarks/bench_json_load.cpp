@@ -0,0 +1,42 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "../src/json_parser.h"
+#include "../src/task.h"
+
+// Usage: bench_json_load [task_count]   (default: 2,000,000)
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+    std::cout << "Generating " << count << " tasks..." << std::endl;
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    const char *priorities[] = {"high", "medium", "low"};
+    for (size_t i = 0; i < count; ++i)
+    {
+        tasks.emplace_back(static_cast<int>(i + 1),
+                           "Task number " + std::to_string(i) + " with a \"quoted\" {brace} description",
+                           priorities[i % 3], "2025-06-15", "2025-01-01");
+    }
+
+    std::string json = JSONParser::tasksToJSON(tasks);
+    tasks.clear();
+    tasks.shrink_to_fit();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Task> parsed = JSONParser::parseTasksFromJSON(json);
+    auto end = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double megabytes = static_cast<double>(json.size()) / (1024.0 * 1024.0);
+
+    std::cout << "Parsed " << parsed.size() << " tasks (" << megabytes << " MiB) in "
+              << seconds * 1000.0 << " ms" << std::endl;
+    std::cout << "Throughput: " << megabytes / seconds << " MiB/s, "
+              << static_cast<double>(parsed.size()) / seconds << " tasks/s" << std::endl;
+
+    return parsed.size() == count ? 0 : 1;
+}
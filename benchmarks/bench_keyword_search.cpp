@@ -0,0 +1,78 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "../src/keyword_index.h"
+#include "../src/task.h"
+
+namespace
+{
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+// Usage: bench_keyword_search [task_count]   (default: 1,000,000)
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::cout << "Generating " << count << " tasks..." << std::endl;
+    const char *words[] = {"review", "write", "deploy", "fix", "plan", "meeting", "report", "invoice",
+                           "client", "budget", "server", "design", "release", "backlog", "sprint", "audit"};
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        std::string description = std::string(words[i % 16]) + " " + words[(i / 16) % 16] + " " +
+                                  words[(i / 256) % 16] + " #" + std::to_string(i);
+        tasks.emplace_back(static_cast<int>(i + 1), std::move(description), TaskStatus::Pending,
+                           TaskPriority::Medium, 0, 0);
+    }
+
+    KeywordIndex index;
+    double buildMs = timeMs([&]
+                            {
+        for (const Task &task : tasks)
+        {
+            index.add(task.getId(), task.getDescription());
+        } });
+    std::cout << "Index build: " << buildMs << " ms (" << index.trigramCount() << " trigrams)" << std::endl;
+
+    const std::string queries[] = {"#123456", "audit invoice", "sprint", "deploy client budget"};
+    bool agree = true;
+    for (const std::string &query : queries)
+    {
+        size_t scanned = 0;
+        double scanMs = timeMs([&]
+                               {
+            for (const Task &task : tasks)
+            {
+                if (task.matchesLowercaseKeyword(query))
+                    scanned++;
+            } });
+
+        size_t indexed = 0;
+        std::vector<int> ids;
+        double indexMs = timeMs([&]
+                                {
+            index.candidates(query, ids);
+            for (int id : ids)
+            {
+                if (tasks[static_cast<size_t>(id - 1)].matchesLowercaseKeyword(query))
+                    indexed++;
+            } });
+
+        std::cout << "\"" << query << "\": scan " << scanMs << " ms, index " << indexMs << " ms ("
+                  << indexed << " matches, " << ids.size() << " candidates)" << std::endl;
+        agree = agree && scanned == indexed;
+    }
+
+    return agree ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <filesystem>
+#include <unistd.h>
+#include "../src/task_manager.h"
+#include "../src/binary_snapshot.h"
+#include "../src/filter_utils.h"
+
+namespace
+{
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+// Usage: bench_query_plan [task_count]   (default: 1,000,000)
+// Times TaskManager::viewTasksMatching on selective and broad predicates,
+// showing which path the planner picked, against a plain row filter.
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::string dirTemplate = std::filesystem::temp_directory_path().string() + "/bench_query_plan_XXXXXX";
+    if (!::mkdtemp(dirTemplate.data()))
+    {
+        std::cerr << "Error: Could not create a temporary directory" << std::endl;
+        return 1;
+    }
+    std::string storePath = dirTemplate + "/tasks.bin";
+
+    const char *words[] = {"Review", "write", "Deploy", "fix", "plan", "meeting", "report", "invoice"};
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < count; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        std::string description = std::string(words[seed % 8]) + " the quarterly " + words[(seed >> 3) % 8] +
+                                  " for client #" + std::to_string(i);
+        tasks.emplace_back(static_cast<int>(i + 1), std::move(description), static_cast<TaskStatus>((seed >> 6) % 3),
+                           static_cast<TaskPriority>((seed >> 8) % 3), static_cast<int32_t>(19000 + (seed >> 10) % 3650), 19000);
+    }
+    if (!BinarySnapshot::write(storePath, tasks, static_cast<int>(count) + 1))
+    {
+        std::filesystem::remove_all(dirTemplate);
+        return 1;
+    }
+    tasks.clear();
+
+    bool agree = true;
+    {
+        TaskManager manager(storePath);
+        TaskView all = manager.viewAllTasks();
+
+        QueryContext context{20500};
+        struct Query
+        {
+            const char *name;
+            FilterUtils::TaskPredicate predicate;
+        };
+        Query queries[] = {
+            {"status=pending", FilterUtils::compileCriteria(context, "", "", "pending")},
+            {"pending+high", FilterUtils::compileCriteria(context, "", "high", "pending")},
+            {"pending+overdue", FilterUtils::compileCriteria(context, "", "", "pending", "", true)},
+            {"pending+high+overdue", FilterUtils::compileCriteria(context, "", "high", "pending", "", true)},
+            {"pending+overdue 50 days in", FilterUtils::compileCriteria(QueryContext{19050}, "", "", "pending", "", true)},
+            {"pending+overdue 20 days in", FilterUtils::compileCriteria(QueryContext{19020}, "", "", "pending", "", true)},
+            {"high+due by 2026-02-10", FilterUtils::compileCriteria(context, "", "high", "", "2026-02-10")},
+            {"high+due today", FilterUtils::compileCriteria(context, "", "high", "", "", false, true)},
+        };
+
+        std::cout << count << " tasks" << std::endl;
+        for (const Query &query : queries)
+        {
+            size_t plannedMatches = 0, rowMatches = 0;
+            double plannedMs = timeMs([&]
+                                      { plannedMatches = manager.viewTasksMatching(query.predicate).size(); });
+            double rowMs = timeMs([&]
+                                  {
+                for (const Task *task : all)
+                    rowMatches += query.predicate.matches(*task) ? 1 : 0; });
+            std::cout << "  " << query.name << ": "
+                      << (manager.prefersColumnScan(query.predicate) ? "column scan " : "index walk ")
+                      << plannedMs << " ms, row filter " << rowMs << " ms (" << plannedMatches << " matches)"
+                      << std::endl;
+            agree = agree && plannedMatches == rowMatches;
+        }
+    }
+
+    std::filesystem::remove_all(dirTemplate);
+    return agree ? 0 : 1;
+}
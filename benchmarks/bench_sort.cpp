@@ -0,0 +1,102 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "../src/filter_utils.h"
+#include "../src/task.h"
+
+namespace
+{
+    // Comparison sorts as they were before keys were precomputed
+    TaskView comparatorSortByDueDate(TaskView tasks)
+    {
+        std::sort(tasks.begin(), tasks.end(), [](const Task *a, const Task *b)
+                  {
+            if (!a->hasDueDate()) return false;
+            if (!b->hasDueDate()) return true;
+            return a->getDueDay() < b->getDueDay(); });
+        return tasks;
+    }
+
+    TaskView comparatorSortByPriority(TaskView tasks)
+    {
+        std::sort(tasks.begin(), tasks.end(), [](const Task *a, const Task *b)
+                  { return a->getPriorityCode() > b->getPriorityCode(); });
+        return tasks;
+    }
+
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    void run(size_t count)
+    {
+        std::vector<Task> tasks;
+        tasks.reserve(count);
+        const TaskPriority priorities[] = {TaskPriority::High, TaskPriority::Medium, TaskPriority::Low};
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < count; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            int32_t due = (seed >> 8) % 10 == 0 ? INT32_MIN : static_cast<int32_t>(19000 + (seed >> 8) % 3650);
+            tasks.emplace_back(static_cast<int>(i + 1), "Task", TaskStatus::Pending,
+                               priorities[(seed >> 4) % 3], due, 19000);
+        }
+        TaskView view = FilterUtils::viewOf(tasks);
+
+        TaskView expected, actual;
+        double comparatorDueMs = timeMs([&]
+                                        { expected = comparatorSortByDueDate(view); });
+        double radixDueMs = timeMs([&]
+                                   { actual = FilterUtils::sortByDueDate(view, true); });
+        bool dueAgrees = std::equal(expected.begin(), expected.end(), actual.begin(),
+                                    [](const Task *a, const Task *b)
+                                    { return a->getDueDay() == b->getDueDay(); });
+
+        double comparatorPriorityMs = timeMs([&]
+                                             { expected = comparatorSortByPriority(view); });
+        double radixPriorityMs = timeMs([&]
+                                        { actual = FilterUtils::sortByPriority(view, false); });
+        bool priorityAgrees = std::equal(expected.begin(), expected.end(), actual.begin(),
+                                         [](const Task *a, const Task *b)
+                                         { return a->getPriorityCode() == b->getPriorityCode(); });
+
+        // Composite spec: one packed key, so it should cost about the same as one field
+        double compositeMs = timeMs([&]
+                                    { actual = FilterUtils::sortBy(view, "priority:desc,due_date:asc,id", true); });
+
+        std::cout << count << " tasks" << std::endl;
+        std::cout << "  due date: comparator " << comparatorDueMs << " ms, radix " << radixDueMs << " ms"
+                  << (dueAgrees ? "" : "  MISMATCH") << std::endl;
+        std::cout << "  priority: comparator " << comparatorPriorityMs << " ms, radix " << radixPriorityMs << " ms"
+                  << (priorityAgrees ? "" : "  MISMATCH") << std::endl;
+        std::cout << "  priority:desc,due_date:asc,id: radix " << compositeMs << " ms" << std::endl;
+    }
+}
+
+// Usage: bench_sort [task_count ...]   (default: 1,000,000 and 10,000,000)
+int main(int argc, char *argv[])
+{
+    std::vector<size_t> counts;
+    for (int i = 1; i < argc; ++i)
+    {
+        counts.push_back(std::strtoull(argv[i], nullptr, 10));
+    }
+    if (counts.empty())
+    {
+        counts = {1000000, 10000000};
+    }
+
+    for (size_t count : counts)
+    {
+        run(count);
+    }
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include "../src/filter_utils.h"
+#include "../src/task.h"
+
+namespace
+{
+    template <typename Fn>
+    double timeMs(Fn &&fn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+// Usage: bench_topk [task_count] [k]   (default: 1,000,000 and 20)
+int main(int argc, char *argv[])
+{
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t k = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 20;
+
+    std::vector<Task> tasks;
+    tasks.reserve(count);
+    const TaskPriority priorities[] = {TaskPriority::High, TaskPriority::Medium, TaskPriority::Low};
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < count; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        int32_t due = (seed >> 8) % 10 == 0 ? INT32_MIN : static_cast<int32_t>(19000 + (seed >> 8) % 3650);
+        tasks.emplace_back(static_cast<int>(i + 1), "Task", TaskStatus::Pending,
+                           priorities[(seed >> 4) % 3], due, 19000);
+    }
+    TaskView view = FilterUtils::viewOf(tasks);
+
+    // "Top k high-priority tasks due soonest"
+    FilterUtils::TaskPredicate predicate = FilterUtils::compileCriteria(QueryContext(), "", "high");
+    std::vector<FilterUtils::SortKey> keys;
+    FilterUtils::parseSortSpec("due_date", true, keys);
+
+    TaskView expected, actual;
+    double fullMs = timeMs([&]
+                           {
+        expected = FilterUtils::sortByKeys(FilterUtils::filterByCriteria(view, predicate), keys);
+        expected.resize(std::min(k, expected.size())); });
+
+    double topMs = timeMs([&]
+                          { actual = FilterUtils::sortTopK(FilterUtils::filterByCriteria(view, predicate), keys, k); });
+    bool agrees = expected == actual;
+
+    // Second page through a cursor: the cursor filter is one more linear pass
+    FilterUtils::PageRequest page;
+    page.limit = k;
+    FilterUtils::TaskPage first, second;
+    double pageMs = timeMs([&]
+                           {
+        FilterUtils::paginate(FilterUtils::filterByCriteria(view, predicate), keys, page, first);
+        page.after = first.next_cursor;
+        FilterUtils::paginate(FilterUtils::filterByCriteria(view, predicate), keys, page, second); });
+
+    std::cout << count << " tasks, top " << k << " high priority by due date" << std::endl;
+    std::cout << "  full sort + truncate: " << fullMs << " ms" << std::endl;
+    std::cout << "  bounded heap:         " << topMs << " ms" << (agrees ? "" : "  MISMATCH") << std::endl;
+    std::cout << "  two cursor pages:     " << pageMs << " ms" << std::endl;
+    return agrees ? 0 : 1;
+}
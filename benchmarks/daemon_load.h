@@ -0,0 +1,275 @@
+#ifndef DAEMON_LOAD_H
+#define DAEMON_LOAD_H
+
+// Load driver shared by the daemon benchmarks: starts a Server on a scratch
+// store in a background thread and drives many clients from one epoll loop,
+// each keeping a fixed number of requests in flight.
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "../src/json_parser.h"
+#include "../src/server.h"
+#include "../src/task_manager.h"
+#include "../src/wire_protocol.h"
+
+namespace DaemonLoad
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Config
+    {
+        size_t clients = 1000;
+        size_t perClient = 100;
+        size_t depth = 1;
+        size_t taskCount = 10000;
+        bool writes = false;         // add/update mutations instead of reads
+        int commitWindowMicros = 0;  // Passed to the Server
+        std::string directory = "/tmp"; // Where the scratch store lives
+    };
+
+    struct Result
+    {
+        size_t connected = 0;
+        size_t failures = 0;
+        double seconds = 0.0;
+        std::vector<double> latencies; // Microseconds, sorted
+    };
+
+    struct Client
+    {
+        int fd = -1;
+        std::string input;
+        std::string output;
+        size_t outputOffset = 0;
+        std::deque<Clock::time_point> sent; // One per request in flight
+        size_t remaining = 0;                // Requests not yet sent
+    };
+
+    inline int connectTo(const std::string &path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+        {
+            if (fd >= 0)
+                ::close(fd);
+            return -1;
+        }
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+        return fd;
+    }
+
+    // A read-only mix of what scripts typically ask, or a stream of mutations
+    inline std::vector<std::string> requestFor(const Config &config, size_t n)
+    {
+        static const std::vector<std::vector<std::string>> READS = {
+            {"count", "--status", "pending"},
+            {"list", "--priority", "high", "--sort", "due_date", "--limit", "10"},
+            {"stats"},
+            {"search", "report", "--limit", "5"},
+        };
+        if (!config.writes)
+            return READS[n % READS.size()];
+        if (n % 2 == 0)
+            return {"add", "Scripted task " + std::to_string(n), "--priority", "low"};
+        return {"update", std::to_string(1 + n % config.taskCount), "--status", "in_progress"};
+    }
+
+    inline bool flush(Client &client)
+    {
+        while (client.outputOffset < client.output.size())
+        {
+            ssize_t n = ::send(client.fd, client.output.data() + client.outputOffset,
+                               client.output.size() - client.outputOffset, MSG_NOSIGNAL);
+            if (n < 0 && errno == EAGAIN)
+                return true;
+            if (n <= 0)
+                return false;
+            client.outputOffset += static_cast<size_t>(n);
+        }
+        client.output.clear();
+        client.outputOffset = 0;
+        return true;
+    }
+
+    inline void sendRequest(const Config &config, Client &client, size_t n)
+    {
+        client.output += WireProtocol::encodeRequest(requestFor(config, n));
+        client.sent.push_back(Clock::now());
+        --client.remaining;
+    }
+
+    inline double percentile(const std::vector<double> &sorted, double p)
+    {
+        if (sorted.empty())
+            return 0.0;
+        size_t index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    inline Result run(const Config &config)
+    {
+        Result result;
+
+        // Each client costs a descriptor on both ends
+        rlimit limit;
+        if (::getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+        {
+            limit.rlim_cur = limit.rlim_max;
+            ::setrlimit(RLIMIT_NOFILE, &limit);
+        }
+
+        std::string dirTemplate = config.directory + "/bench_daemon_XXXXXX";
+        if (!::mkdtemp(dirTemplate.data()))
+        {
+            result.failures = config.clients * config.perClient;
+            return result;
+        }
+        std::string dir = dirTemplate;
+        std::string storePath = dir + "/tasks.json";
+        std::string socketPath = dir + "/tasks.sock";
+
+        std::vector<Task> tasks;
+        tasks.reserve(config.taskCount);
+        const char *priorities[] = {"high", "medium", "low"};
+        const char *words[] = {"report", "review", "deploy", "meeting"};
+        for (size_t i = 0; i < config.taskCount; ++i)
+        {
+            tasks.emplace_back(static_cast<int>(i + 1), std::string("Weekly ") + words[i % 4] + " " + std::to_string(i),
+                               priorities[i % 3], "2025-06-" + std::to_string(10 + i % 20), "2025-01-01");
+        }
+        std::ofstream(storePath) << JSONParser::tasksToJSON(tasks);
+        tasks.clear();
+
+        TaskManager taskManager(storePath);
+        Server server(taskManager, socketPath, config.commitWindowMicros);
+
+        // The server thread swaps std::cout per request, so nothing may be
+        // printed until it has stopped
+        std::thread serverThread([&server]
+                                 { server.run(); });
+        while (!Server::isListening(socketPath))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        int epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+        std::vector<Client> clients(config.clients);
+        result.latencies.reserve(config.clients * config.perClient);
+        size_t depth = std::max<size_t>(1, config.depth);
+
+        auto start = Clock::now();
+        for (size_t i = 0; i < clients.size(); ++i)
+        {
+            Client &client = clients[i];
+            client.fd = connectTo(socketPath);
+            if (client.fd < 0)
+            {
+                result.failures += config.perClient;
+                continue;
+            }
+            ++result.connected;
+            client.remaining = config.perClient;
+            while (client.remaining > 0 && client.sent.size() < depth)
+            {
+                sendRequest(config, client, i * config.perClient + client.remaining);
+            }
+            flush(client);
+
+            epoll_event event{};
+            event.events = EPOLLIN | EPOLLOUT;
+            event.data.u64 = i;
+            ::epoll_ctl(epollFd, EPOLL_CTL_ADD, client.fd, &event);
+        }
+
+        size_t open = result.connected;
+        std::vector<epoll_event> events(256);
+        char chunk[65536];
+        while (open > 0)
+        {
+            int ready = ::epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), 5000);
+            if (ready <= 0)
+                break;
+            for (int e = 0; e < ready; ++e)
+            {
+                size_t index = events[e].data.u64;
+                Client &client = clients[index];
+                if (client.fd < 0)
+                    continue;
+
+                bool alive = flush(client);
+                ssize_t n;
+                while (alive && (n = ::read(client.fd, chunk, sizeof(chunk))) > 0)
+                {
+                    client.input.append(chunk, static_cast<size_t>(n));
+                }
+
+                size_t offset = 0;
+                std::string_view payload;
+                std::string out, err;
+                bool more = false;
+                while (WireProtocol::takeFrame(client.input, offset, payload) == WireProtocol::FrameStatus::Complete)
+                {
+                    // A response is done with its last part
+                    if (!WireProtocol::decodeResponse(payload, out, err, more) || more)
+                        continue;
+                    auto now = Clock::now();
+                    result.latencies.push_back(std::chrono::duration<double, std::micro>(now - client.sent.front()).count());
+                    client.sent.pop_front();
+                    if (client.remaining > 0)
+                        sendRequest(config, client, index * config.perClient + client.remaining);
+                }
+                client.input.erase(0, offset);
+                alive = alive && flush(client);
+
+                if (!alive || (client.remaining == 0 && client.sent.empty()))
+                {
+                    result.failures += client.sent.size() + client.remaining;
+                    ::epoll_ctl(epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+                    ::close(client.fd);
+                    client.fd = -1;
+                    --open;
+                }
+            }
+        }
+        result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        for (Client &client : clients)
+        {
+            if (client.fd >= 0)
+            {
+                result.failures += client.sent.size() + client.remaining;
+                ::close(client.fd);
+            }
+        }
+
+        server.stop();
+        serverThread.join();
+        ::close(epollFd);
+        std::remove(storePath.c_str());
+        std::remove((storePath + ".journal").c_str());
+        std::remove((storePath + ".tmp").c_str());
+        ::rmdir(dir.c_str());
+
+        std::sort(result.latencies.begin(), result.latencies.end());
+        return result;
+    }
+}
+
+#endif
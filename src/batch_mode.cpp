@@ -0,0 +1,78 @@
+#include "batch_mode.h"
+#include "interactive_mode.h"
+#include <iostream>
+
+BatchMode::BatchMode(TaskManager &tm) : taskManager(tm), commandHandler(tm) {}
+
+bool BatchMode::nextCommand(std::istream &input, std::vector<std::string> &args, size_t &lineNumber)
+{
+    std::string line;
+    while (std::getline(input, line))
+    {
+        ++lineNumber;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back(); // Scripts saved with CRLF line endings
+
+        size_t first = line.find_first_not_of(" \t");
+        if (first == std::string::npos || line[first] == '#')
+            continue;
+
+        args = InteractiveMode::tokenize(line.substr(first));
+        if (!args.empty())
+            return true;
+    }
+    return false;
+}
+
+bool BatchMode::isCommitCommand(const std::vector<std::string> &args)
+{
+    return args.size() == 1 && args[0] == "commit";
+}
+
+bool BatchMode::isAllowed(const std::vector<std::string> &args, size_t lineNumber)
+{
+    const std::string &command = args[0];
+    if (command == "batch" || command == "serve" || command == "interactive" || command == "-i" ||
+        command == "--interactive")
+    {
+        std::cerr << "Error: line " << lineNumber << ": '" << command << "' cannot run inside a batch." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool BatchMode::run(std::istream &input)
+{
+    taskManager.setDeferredJournalSync(true);
+
+    bool durable = true;
+    size_t lineNumber = 0;
+    size_t commands = 0;
+    std::vector<std::string> args;
+    while (nextCommand(input, args, lineNumber))
+    {
+        if (isCommitCommand(args))
+        {
+            durable = taskManager.syncJournal() && durable;
+            continue;
+        }
+        if (!isAllowed(args, lineNumber))
+            continue;
+
+        try
+        {
+            commandHandler.processCommand(args);
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Error: line " << lineNumber << ": " << e.what() << std::endl;
+        }
+        ++commands;
+    }
+
+    // Switching back writes everything still buffered with one fsync
+    durable = taskManager.setDeferredJournalSync(false) && durable;
+
+    std::cout << "Batch finished: " << commands << " commands." << std::endl;
+    return durable;
+}
@@ -0,0 +1,33 @@
+#ifndef BATCH_MODE_H
+#define BATCH_MODE_H
+
+#include <istream>
+#include <string>
+#include <vector>
+#include "task_manager.h"
+#include "command_handler.h"
+
+// Runs a script of commands, one per line, against one loaded TaskManager.
+// Lines are split like interactive input; blank lines and lines starting
+// with '#' are skipped. Journal writes are synced once at the end and at
+// each "commit" line instead of once per mutation.
+class BatchMode
+{
+private:
+    TaskManager &taskManager;
+    CommandHandler commandHandler;
+
+public:
+    explicit BatchMode(TaskManager &tm);
+
+    // Returns false if a commit failed
+    bool run(std::istream &input);
+
+    // Next command in input; false at the end. lineNumber tracks the line read.
+    static bool nextCommand(std::istream &input, std::vector<std::string> &args, size_t &lineNumber);
+    static bool isCommitCommand(const std::vector<std::string> &args);
+    // Modes of their own cannot be nested in a script (prints why)
+    static bool isAllowed(const std::vector<std::string> &args, size_t lineNumber);
+};
+
+#endif
@@ -0,0 +1,205 @@
+#include "binary_snapshot.h"
+#include "date_utils.h"
+#include "durable_file.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+    const char MAGIC[8] = {'T', 'T', 'S', 'N', 'A', 'P', '\0', '\0'};
+}
+
+namespace BinarySnapshot
+{
+
+    bool isSnapshotPath(const std::string &path)
+    {
+        const std::string extension = ".bin";
+        return path.size() > extension.size() &&
+               path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+    }
+
+    uint32_t packDay(int32_t day_number)
+    {
+        if (day_number == DateUtils::NO_DATE)
+            return 0;
+
+        int year, month, day;
+        DateUtils::fromDayNumber(day_number, year, month, day);
+        return static_cast<uint32_t>(year * 10000 + month * 100 + day);
+    }
+
+    bool isValidPackedDay(uint32_t packed)
+    {
+        return packed == 0 || DateUtils::isValidDate(static_cast<int>(packed / 10000),
+                                                     static_cast<int>((packed / 100) % 100),
+                                                     static_cast<int>(packed % 100));
+    }
+
+    int32_t unpackDay(uint32_t packed)
+    {
+        if (packed == 0 || !isValidPackedDay(packed))
+            return DateUtils::NO_DATE;
+        return DateUtils::toDayNumber(static_cast<int>(packed / 10000), static_cast<int>((packed / 100) % 100),
+                                      static_cast<int>(packed % 100));
+    }
+
+    bool write(const std::string &path, const std::vector<Task> &tasks, int nextId)
+    {
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.count = static_cast<uint32_t>(tasks.size());
+        header.nextId = nextId;
+        header.heapOffset = sizeof(Header) + tasks.size() * sizeof(Record);
+
+        std::vector<Record> records;
+        records.reserve(tasks.size());
+        std::string heap;
+
+        for (const Task &task : tasks)
+        {
+            const std::string &description = task.getDescription();
+
+            Record record{};
+            record.id = task.getId();
+            record.status = static_cast<uint8_t>(task.getStatusCode());
+            record.priority = static_cast<uint8_t>(task.getPriorityCode());
+            record.dueDate = packDay(task.getDueDay());
+            record.createdDate = packDay(task.getCreatedDay());
+            record.descriptionLength = static_cast<uint32_t>(description.size());
+            record.descriptionOffset = heap.size();
+            records.push_back(record);
+
+            heap += description;
+        }
+        header.heapSize = heap.size();
+
+        // Replaced atomically and durably, so readers never map a partial file
+        std::string_view headerBytes(reinterpret_cast<const char *>(&header), sizeof(header));
+        std::string_view recordBytes(reinterpret_cast<const char *>(records.data()), records.size() * sizeof(Record));
+        if (!DurableFile::replace(path, {headerBytes, recordBytes, heap}))
+        {
+            std::cerr << "Error: Cannot write snapshot " << path << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+}
+
+MappedSnapshot::MappedSnapshot() : data(nullptr), length(0) {}
+
+MappedSnapshot::~MappedSnapshot()
+{
+    close();
+}
+
+bool MappedSnapshot::open(const std::string &path)
+{
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(BinarySnapshot::Header))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void *mapping = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+        return false;
+
+    data = static_cast<const char *>(mapping);
+    length = static_cast<size_t>(st.st_size);
+
+    // Validate the header and that every section lies inside the mapping
+    // (compared by subtraction, since a damaged size could wrap a sum)
+    const BinarySnapshot::Header &h = header();
+    bool valid = std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+                 h.version == BinarySnapshot::VERSION &&
+                 h.heapOffset == sizeof(BinarySnapshot::Header) + uint64_t(h.count) * sizeof(BinarySnapshot::Record) &&
+                 h.heapOffset <= length && h.heapSize <= length - h.heapOffset;
+    if (!valid)
+    {
+        std::cerr << "Error: " << path << " is not a valid task snapshot." << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedSnapshot::close()
+{
+    if (data != nullptr)
+    {
+        ::munmap(const_cast<char *>(data), length);
+        data = nullptr;
+        length = 0;
+    }
+}
+
+bool MappedSnapshot::isOpen() const
+{
+    return data != nullptr;
+}
+
+const BinarySnapshot::Header &MappedSnapshot::header() const
+{
+    return *reinterpret_cast<const BinarySnapshot::Header *>(data);
+}
+
+uint32_t MappedSnapshot::count() const
+{
+    return isOpen() ? header().count : 0;
+}
+
+int MappedSnapshot::nextId() const
+{
+    return isOpen() ? header().nextId : 1;
+}
+
+const BinarySnapshot::Record &MappedSnapshot::record(size_t index) const
+{
+    const char *records = data + sizeof(BinarySnapshot::Header);
+    return reinterpret_cast<const BinarySnapshot::Record *>(records)[index];
+}
+
+std::string_view MappedSnapshot::description(size_t index) const
+{
+    const BinarySnapshot::Record &r = record(index);
+    const BinarySnapshot::Header &h = header();
+    if (r.descriptionOffset > h.heapSize || r.descriptionLength > h.heapSize - r.descriptionOffset)
+        return std::string_view();
+    return std::string_view(data + h.heapOffset + r.descriptionOffset, r.descriptionLength);
+}
+
+bool MappedSnapshot::isValid(size_t index) const
+{
+    const BinarySnapshot::Record &r = record(index);
+    const BinarySnapshot::Header &h = header();
+    return r.id > 0 && r.status <= 2 && r.priority <= 2 &&
+           BinarySnapshot::isValidPackedDay(r.dueDate) && BinarySnapshot::isValidPackedDay(r.createdDate) &&
+           r.descriptionOffset <= h.heapSize && r.descriptionLength <= h.heapSize - r.descriptionOffset;
+}
+
+Task MappedSnapshot::toTask(size_t index) const
+{
+    // Out-of-range fields fall back to defaults; isValid() reports them
+    const BinarySnapshot::Record &r = record(index);
+    TaskStatus status = r.status > 2 ? TaskStatus::Pending : static_cast<TaskStatus>(r.status);
+    TaskPriority priority = r.priority > 2 ? TaskPriority::Medium : static_cast<TaskPriority>(r.priority);
+    return Task(r.id, std::string(description(index)), status, priority,
+                BinarySnapshot::unpackDay(r.dueDate), BinarySnapshot::unpackDay(r.createdDate));
+}
@@ -0,0 +1,90 @@
+#ifndef BINARY_SNAPSHOT_H
+#define BINARY_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "task.h"
+
+// Binary snapshot layout (host byte order):
+//   Header | Record[count] | description heap
+// Records are fixed-width so a mapped file can be indexed directly; dates are
+// packed as YYYYMMDD integers (0 = no date) and descriptions live in the heap.
+namespace BinarySnapshot
+{
+    const uint32_t VERSION = 1;
+
+    struct Header
+    {
+        char magic[8]; // "TTSNAP\0\0"
+        uint32_t version;
+        uint32_t count;
+        int32_t nextId;
+        uint32_t reserved;
+        uint64_t heapOffset;
+        uint64_t heapSize;
+    };
+
+    struct Record
+    {
+        int32_t id;
+        uint8_t status;   // 0 = pending, 1 = in_progress, 2 = done
+        uint8_t priority; // 0 = low, 1 = medium, 2 = high
+        uint16_t reserved;
+        uint32_t dueDate;     // YYYYMMDD, 0 if unset
+        uint32_t createdDate; // YYYYMMDD
+        uint32_t descriptionLength;
+        uint64_t descriptionOffset; // relative to the heap
+    };
+
+    static_assert(sizeof(Header) == 40, "snapshot header layout changed");
+    static_assert(sizeof(Record) == 32, "snapshot record layout changed");
+
+    // Snapshots are selected by file extension; everything else is JSON
+    bool isSnapshotPath(const std::string &path);
+
+    bool write(const std::string &path, const std::vector<Task> &tasks, int nextId);
+
+    // Day number <-> YYYYMMDD (DateUtils::NO_DATE <-> 0). An impossible date
+    // (month 13, February 30, ...) unpacks to NO_DATE.
+    uint32_t packDay(int32_t day_number);
+    int32_t unpackDay(uint32_t packed);
+    bool isValidPackedDay(uint32_t packed); // 0 or a real YYYYMMDD date
+}
+
+// Read-only memory mapping of a binary snapshot. Records are accessed in
+// place; nothing is copied until a caller asks for a Task. TaskManager
+// loads a store by converting every record, so the mapping saves the
+// parsing, not the per-task work.
+class MappedSnapshot
+{
+private:
+    const char *data;
+    size_t length;
+
+    const BinarySnapshot::Header &header() const;
+
+public:
+    MappedSnapshot();
+    ~MappedSnapshot();
+    MappedSnapshot(const MappedSnapshot &) = delete;
+    MappedSnapshot &operator=(const MappedSnapshot &) = delete;
+
+    // Returns false if the file is missing or not a valid snapshot
+    bool open(const std::string &path);
+    void close();
+    bool isOpen() const;
+
+    uint32_t count() const;
+    int nextId() const;
+    const BinarySnapshot::Record &record(size_t index) const;
+    std::string_view description(size_t index) const;
+    // False if the record has an ID <= 0, an unknown status or priority, an
+    // impossible date or a description outside the heap
+    bool isValid(size_t index) const;
+    Task toTask(size_t index) const;
+};
+
+#endif
@@ -0,0 +1,289 @@
+#include "bitmap.h"
+#include <algorithm>
+#include <iterator>
+
+bool Bitmap::Container::contains(uint16_t low) const
+{
+    if (isBitset())
+        return (words[low >> 6] >> (low & 63)) & 1;
+    return std::binary_search(values.begin(), values.end(), low);
+}
+
+bool Bitmap::Container::add(uint16_t low)
+{
+    if (isBitset())
+    {
+        uint64_t mask = uint64_t(1) << (low & 63);
+        if (words[low >> 6] & mask)
+            return false;
+        words[low >> 6] |= mask;
+        cardinality++;
+        return true;
+    }
+
+    // IDs mostly arrive in increasing order, which makes this an append
+    if (values.empty() || values.back() < low)
+    {
+        values.push_back(low);
+    }
+    else
+    {
+        auto it = std::lower_bound(values.begin(), values.end(), low);
+        if (*it == low)
+            return false;
+        values.insert(it, low);
+    }
+
+    cardinality++;
+    if (cardinality > ARRAY_LIMIT)
+        toBitset();
+    return true;
+}
+
+bool Bitmap::Container::remove(uint16_t low)
+{
+    if (isBitset())
+    {
+        uint64_t mask = uint64_t(1) << (low & 63);
+        if (!(words[low >> 6] & mask))
+            return false;
+        words[low >> 6] &= ~mask;
+        cardinality--;
+        if (cardinality <= ARRAY_LIMIT / 2)
+            toArray();
+        return true;
+    }
+
+    auto it = std::lower_bound(values.begin(), values.end(), low);
+    if (it == values.end() || *it != low)
+        return false;
+    values.erase(it);
+    cardinality--;
+    return true;
+}
+
+void Bitmap::Container::toBitset()
+{
+    words.assign(BITSET_WORDS, 0);
+    for (uint16_t low : values)
+        words[low >> 6] |= uint64_t(1) << (low & 63);
+    values.clear();
+    values.shrink_to_fit();
+}
+
+void Bitmap::Container::toArray()
+{
+    values.clear();
+    values.reserve(cardinality);
+    for (size_t w = 0; w < words.size(); ++w)
+    {
+        uint64_t word = words[w];
+        while (word != 0)
+        {
+            values.push_back(static_cast<uint16_t>(w * 64 + static_cast<size_t>(__builtin_ctzll(word))));
+            word &= word - 1;
+        }
+    }
+    words.clear();
+    words.shrink_to_fit();
+}
+
+Bitmap::Container *Bitmap::findContainer(uint16_t key)
+{
+    auto it = std::lower_bound(containers.begin(), containers.end(), key,
+                               [](const Container &c, uint16_t k)
+                               { return c.key < k; });
+    return (it != containers.end() && it->key == key) ? &*it : nullptr;
+}
+
+const Bitmap::Container *Bitmap::findContainer(uint16_t key) const
+{
+    return const_cast<Bitmap *>(this)->findContainer(key);
+}
+
+bool Bitmap::add(uint32_t value)
+{
+    uint16_t key = static_cast<uint16_t>(value >> 16);
+    uint16_t low = static_cast<uint16_t>(value & 0xFFFF);
+
+    if (containers.empty() || containers.back().key < key)
+    {
+        containers.emplace_back();
+        containers.back().key = key;
+        return containers.back().add(low);
+    }
+
+    auto it = std::lower_bound(containers.begin(), containers.end(), key,
+                               [](const Container &c, uint16_t k)
+                               { return c.key < k; });
+    if (it == containers.end() || it->key != key)
+    {
+        it = containers.insert(it, Container());
+        it->key = key;
+    }
+    return it->add(low);
+}
+
+bool Bitmap::remove(uint32_t value)
+{
+    Container *container = findContainer(static_cast<uint16_t>(value >> 16));
+    if (container == nullptr || !container->remove(static_cast<uint16_t>(value & 0xFFFF)))
+        return false;
+
+    if (container->cardinality == 0)
+    {
+        containers.erase(containers.begin() + (container - containers.data()));
+    }
+    return true;
+}
+
+bool Bitmap::contains(uint32_t value) const
+{
+    const Container *container = findContainer(static_cast<uint16_t>(value >> 16));
+    return container != nullptr && container->contains(static_cast<uint16_t>(value & 0xFFFF));
+}
+
+void Bitmap::clear()
+{
+    containers.clear();
+}
+
+bool Bitmap::empty() const
+{
+    return containers.empty();
+}
+
+uint64_t Bitmap::cardinality() const
+{
+    uint64_t total = 0;
+    for (const Container &container : containers)
+        total += container.cardinality;
+    return total;
+}
+
+Bitmap::Container Bitmap::intersect(const Container &a, const Container &b)
+{
+    Container result;
+    result.key = a.key;
+
+    if (a.isBitset() && b.isBitset())
+    {
+        result.words.resize(BITSET_WORDS);
+        uint32_t count = 0;
+        for (size_t w = 0; w < BITSET_WORDS; ++w)
+        {
+            result.words[w] = a.words[w] & b.words[w];
+            count += static_cast<uint32_t>(__builtin_popcountll(result.words[w]));
+        }
+        result.cardinality = count;
+        if (count <= ARRAY_LIMIT)
+            result.toArray();
+        return result;
+    }
+
+    if (a.isBitset() || b.isBitset())
+    {
+        const Container &array = a.isBitset() ? b : a;
+        const Container &bitset = a.isBitset() ? a : b;
+        for (uint16_t low : array.values)
+        {
+            if (bitset.contains(low))
+                result.values.push_back(low);
+        }
+    }
+    else
+    {
+        std::set_intersection(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                              std::back_inserter(result.values));
+    }
+    result.cardinality = static_cast<uint32_t>(result.values.size());
+    return result;
+}
+
+Bitmap::Container Bitmap::unite(const Container &a, const Container &b)
+{
+    Container result;
+    result.key = a.key;
+
+    if (!a.isBitset() && !b.isBitset())
+    {
+        std::set_union(a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+                       std::back_inserter(result.values));
+        result.cardinality = static_cast<uint32_t>(result.values.size());
+        if (result.cardinality > ARRAY_LIMIT)
+            result.toBitset();
+        return result;
+    }
+
+    const Container &bitset = a.isBitset() ? a : b;
+    const Container &other = a.isBitset() ? b : a;
+    result.words = bitset.words;
+    if (other.isBitset())
+    {
+        for (size_t w = 0; w < BITSET_WORDS; ++w)
+            result.words[w] |= other.words[w];
+    }
+    else
+    {
+        for (uint16_t low : other.values)
+            result.words[low >> 6] |= uint64_t(1) << (low & 63);
+    }
+
+    uint32_t count = 0;
+    for (uint64_t word : result.words)
+        count += static_cast<uint32_t>(__builtin_popcountll(word));
+    result.cardinality = count;
+    return result;
+}
+
+Bitmap Bitmap::operator&(const Bitmap &other) const
+{
+    Bitmap result;
+    auto a = containers.begin();
+    auto b = other.containers.begin();
+    while (a != containers.end() && b != other.containers.end())
+    {
+        if (a->key < b->key)
+        {
+            ++a;
+        }
+        else if (b->key < a->key)
+        {
+            ++b;
+        }
+        else
+        {
+            Container both = intersect(*a, *b);
+            if (both.cardinality > 0)
+                result.containers.push_back(std::move(both));
+            ++a;
+            ++b;
+        }
+    }
+    return result;
+}
+
+Bitmap Bitmap::operator|(const Bitmap &other) const
+{
+    Bitmap result;
+    auto a = containers.begin();
+    auto b = other.containers.begin();
+    while (a != containers.end() || b != other.containers.end())
+    {
+        if (b == other.containers.end() || (a != containers.end() && a->key < b->key))
+        {
+            result.containers.push_back(*a++);
+        }
+        else if (a == containers.end() || b->key < a->key)
+        {
+            result.containers.push_back(*b++);
+        }
+        else
+        {
+            result.containers.push_back(unite(*a, *b));
+            ++a;
+            ++b;
+        }
+    }
+    return result;
+}
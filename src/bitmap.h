@@ -0,0 +1,84 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Compressed set of 32-bit integers (task IDs), roaring style.
+//
+// Values are split into 2^16 chunks by their high 16 bits. A chunk holding
+// few values is a sorted array of the low 16 bits; once it passes
+// ARRAY_LIMIT values it becomes a 1024-word bitset. Dense ID ranges (the
+// normal case) cost about one bit per task, and AND/OR/counting work a chunk
+// at a time with word operations and popcounts.
+class Bitmap
+{
+private:
+    static constexpr uint32_t ARRAY_LIMIT = 4096;
+    static constexpr size_t BITSET_WORDS = 65536 / 64;
+
+    struct Container
+    {
+        uint16_t key = 0;
+        uint32_t cardinality = 0;
+        std::vector<uint16_t> values; // Array form: sorted low bits
+        std::vector<uint64_t> words;  // Bitset form (non-empty means bitset)
+
+        bool isBitset() const { return !words.empty(); }
+        bool contains(uint16_t low) const;
+        bool add(uint16_t low);
+        bool remove(uint16_t low);
+        void toBitset();
+        void toArray();
+    };
+
+    std::vector<Container> containers; // Sorted by key
+
+    Container *findContainer(uint16_t key);
+    const Container *findContainer(uint16_t key) const;
+
+    static Container intersect(const Container &a, const Container &b);
+    static Container unite(const Container &a, const Container &b);
+
+public:
+    bool add(uint32_t value);    // False if already present
+    bool remove(uint32_t value); // False if absent
+    bool contains(uint32_t value) const;
+    void clear();
+
+    bool empty() const;
+    uint64_t cardinality() const;
+
+    Bitmap operator&(const Bitmap &other) const;
+    Bitmap operator|(const Bitmap &other) const;
+
+    // Visits values in ascending order
+    template <typename Visitor>
+    void forEach(Visitor &&visit) const
+    {
+        for (const Container &container : containers)
+        {
+            uint32_t high = static_cast<uint32_t>(container.key) << 16;
+            if (!container.isBitset())
+            {
+                for (uint16_t low : container.values)
+                    visit(high | low);
+                continue;
+            }
+
+            for (size_t w = 0; w < container.words.size(); ++w)
+            {
+                uint64_t word = container.words[w];
+                while (word != 0)
+                {
+                    uint32_t bit = static_cast<uint32_t>(__builtin_ctzll(word));
+                    visit(high | static_cast<uint32_t>(w * 64 + bit));
+                    word &= word - 1;
+                }
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,164 @@
+#include "column_filter.h"
+#include "date_utils.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define COLUMN_FILTER_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace ColumnFilter
+{
+    FieldPredicate lower(const FilterUtils::TaskPredicate &predicate)
+    {
+        FieldPredicate fields;
+        fields.match_none = predicate.match_none;
+        fields.check_status = predicate.check_status;
+        fields.check_priority = predicate.check_priority;
+        fields.status = predicate.status;
+        fields.priority = predicate.priority;
+
+        // Every date constraint narrows one inclusive range of due days
+        fields.check_due = predicate.check_due_day || predicate.due_today_only || predicate.overdue_only;
+        fields.due_first = DateUtils::NO_DATE + 1;
+        fields.due_last = std::numeric_limits<int32_t>::max();
+        if (predicate.check_due_day)
+        {
+            fields.due_first = std::max(fields.due_first, predicate.due_day);
+            fields.due_last = std::min(fields.due_last, predicate.due_day);
+        }
+        if (predicate.due_today_only)
+        {
+            fields.due_first = std::max(fields.due_first, predicate.today);
+            fields.due_last = std::min(fields.due_last, predicate.today);
+        }
+        if (predicate.overdue_only)
+        {
+            fields.due_last = std::min(fields.due_last, predicate.today - 1);
+        }
+        return fields;
+    }
+
+    void selectScalar(const FieldPredicate &predicate, const TaskStore::Columns &columns,
+                      size_t begin, size_t end, uint64_t *selection)
+    {
+        size_t words = (end - begin + 63) / 64;
+        std::memset(selection, 0, words * sizeof(uint64_t));
+        if (predicate.match_none)
+            return;
+
+        // Disabled checks always pass, so each slot is one chain of ANDs
+        bool anyStatus = !predicate.check_status;
+        bool anyPriority = !predicate.check_priority;
+        bool anyDue = !predicate.check_due;
+        for (size_t slot = begin; slot < end; ++slot)
+        {
+            int32_t due = columns.dueDay[slot];
+            bool pass = (columns.id[slot] != 0) &
+                        (anyStatus | (columns.status[slot] == predicate.status)) &
+                        (anyPriority | (columns.priority[slot] == predicate.priority)) &
+                        (anyDue | ((due >= predicate.due_first) & (due <= predicate.due_last)));
+            size_t bit = slot - begin;
+            selection[bit / 64] |= static_cast<uint64_t>(pass) << (bit % 64);
+        }
+    }
+
+#ifdef COLUMN_FILTER_AVX2
+    bool hasAvx2()
+    {
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return supported;
+    }
+
+    __attribute__((target("avx2"))) void selectAvx2(const FieldPredicate &predicate, const TaskStore::Columns &columns,
+                                                    size_t begin, size_t end, uint64_t *selection)
+    {
+        size_t words = (end - begin + 63) / 64;
+        std::memset(selection, 0, words * sizeof(uint64_t));
+        if (predicate.match_none)
+            return;
+
+        const uint8_t *status = reinterpret_cast<const uint8_t *>(columns.status.data());
+        const uint8_t *priority = reinterpret_cast<const uint8_t *>(columns.priority.data());
+        const int32_t *ids = columns.id.data();
+        const int32_t *due = columns.dueDay.data();
+
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i wantStatus = _mm256_set1_epi8(static_cast<char>(predicate.status));
+        const __m256i wantPriority = _mm256_set1_epi8(static_cast<char>(predicate.priority));
+        const __m256i dueFirst = _mm256_set1_epi32(predicate.due_first);
+        const __m256i dueLast = _mm256_set1_epi32(predicate.due_last);
+
+        // 32 slots per step: byte columns compare in one vector, int32 columns in four
+        size_t slot = begin;
+        for (; slot + 32 <= end; slot += 32)
+        {
+            uint32_t mask = ~0u;
+            if (predicate.check_status)
+            {
+                __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(status + slot));
+                mask &= static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(values, wantStatus)));
+            }
+            if (predicate.check_priority)
+            {
+                __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(priority + slot));
+                mask &= static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(values, wantPriority)));
+            }
+
+            uint32_t rejected = 0;
+            for (int quarter = 0; quarter < 4; ++quarter)
+            {
+                size_t at = slot + static_cast<size_t>(quarter) * 8;
+                __m256i dead = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ids + at)), zero);
+                if (predicate.check_due)
+                {
+                    __m256i days = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(due + at));
+                    dead = _mm256_or_si256(dead, _mm256_or_si256(_mm256_cmpgt_epi32(dueFirst, days),
+                                                                 _mm256_cmpgt_epi32(days, dueLast)));
+                }
+                rejected |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(dead))) << (quarter * 8);
+            }
+            mask &= ~rejected;
+
+            size_t bit = slot - begin;
+            selection[bit / 64] |= static_cast<uint64_t>(mask) << (bit % 64);
+        }
+
+        if (slot < end)
+        {
+            // Tail: the scalar kernel fills a separate word, shifted into place
+            uint64_t tail[1];
+            selectScalar(predicate, columns, slot, end, tail);
+            size_t bit = slot - begin;
+            selection[bit / 64] |= tail[0] << (bit % 64);
+        }
+    }
+#else
+    bool hasAvx2()
+    {
+        return false;
+    }
+
+    void selectAvx2(const FieldPredicate &predicate, const TaskStore::Columns &columns,
+                    size_t begin, size_t end, uint64_t *selection)
+    {
+        selectScalar(predicate, columns, begin, end, selection);
+    }
+#endif
+
+    void select(const FieldPredicate &predicate, const TaskStore::Columns &columns,
+                size_t begin, size_t end, uint64_t *selection)
+    {
+        if (hasAvx2())
+            selectAvx2(predicate, columns, begin, end, selection);
+        else
+            selectScalar(predicate, columns, begin, end, selection);
+    }
+
+    const char *kernelName()
+    {
+        return hasAvx2() ? "avx2" : "scalar";
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef COLUMN_FILTER_H
+#define COLUMN_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include "filter_utils.h"
+#include "task_store.h"
+
+// Predicate kernels over TaskStore columns.
+//
+// The fixed-width part of a TaskPredicate (status, priority, due range) is
+// evaluated for a block of slots at once into a selection bitmap, one bit
+// per slot. An AVX2 kernel tests 32 slots per step; it is picked at run time
+// when the CPU has AVX2, with a branch-free scalar kernel otherwise.
+namespace ColumnFilter
+{
+    // Slots per select() call in a scan; the bitmap stays in L1
+    const size_t BLOCK_SLOTS = 4096;
+
+    struct FieldPredicate
+    {
+        bool match_none = false;
+        bool check_status = false;
+        bool check_priority = false;
+        bool check_due = false;
+        TaskStatus status = TaskStatus::Pending;
+        TaskPriority priority = TaskPriority::Medium;
+        int32_t due_first = 0; // Inclusive; never NO_DATE, so undated tasks fail
+        int32_t due_last = 0;
+    };
+
+    FieldPredicate lower(const FilterUtils::TaskPredicate &predicate);
+
+    // Bit (slot - begin) of selection is set for each live slot in [begin, end)
+    // that passes. selection needs (end - begin + 63) / 64 words.
+    void select(const FieldPredicate &predicate, const TaskStore::Columns &columns,
+                size_t begin, size_t end, uint64_t *selection);
+
+    // The individual kernels, for tests and benchmarks
+    void selectScalar(const FieldPredicate &predicate, const TaskStore::Columns &columns,
+                      size_t begin, size_t end, uint64_t *selection);
+    bool hasAvx2();
+    void selectAvx2(const FieldPredicate &predicate, const TaskStore::Columns &columns,
+                    size_t begin, size_t end, uint64_t *selection); // Only call if hasAvx2()
+    const char *kernelName(); // Kernel select() uses
+}
+
+#endif
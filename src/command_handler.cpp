@@ -4,8 +4,20 @@
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <string_view>
 
-CommandHandler::CommandHandler(TaskManager &tm) : taskManager(tm) {}
+namespace
+{
+    bool parseCount(const std::string &text, size_t &value)
+    {
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return !text.empty() && ec == std::errc() && ptr == text.data() + text.size();
+    }
+}
+
+CommandHandler::CommandHandler(TaskManager &tm) : taskManager(tm), context(QueryContext::capture()) {}
 
 void CommandHandler::handleAdd(const std::vector<std::string> &args)
 {
@@ -119,14 +131,23 @@ void CommandHandler::handleList(const std::vector<std::string> &args)
         }
     }
 
+    if (!sort_by.empty() && !FilterUtils::isValidSortSpec(sort_by))
+    {
+        std::cerr << "Error: Invalid sort field. Valid fields: priority, due_date, status, id, created_date" << std::endl;
+        return;
+    }
+
+    FilterUtils::PageRequest page;
+    bool paged = false;
+    if (!parsePageRequest(args, page, paged))
+    {
+        return;
+    }
+
     // Check for special filters
     bool due_today = hasFlag(args, "--due-today");
     bool overdue = hasFlag(args, "--overdue");
 
-    // Get filtered and sorted tasks
-    std::vector<Task> tasksToDisplay = taskManager.getTasksFilteredAndSorted(
-        sort_by, ascending, "", priority_filter, status_filter, "", overdue, due_today);
-
     // Generate title
     std::string title = "All Tasks";
     if (!status_filter.empty())
@@ -147,9 +168,21 @@ void CommandHandler::handleList(const std::vector<std::string> &args)
     }
     if (!sort_by.empty())
     {
-        title += " (Sorted by " + sort_by + (ascending ? " asc" : " desc") + ")";
+        bool composite = sort_by.find_first_of(",:") != std::string::npos;
+        title += " (Sorted by " + sort_by + (composite ? "" : (ascending ? " asc" : " desc")) + ")";
+    }
+
+    if (paged)
+    {
+        displayPage(FilterUtils::compileCriteria(context, "", priority_filter, status_filter, "", overdue, due_today),
+                    sort_by, ascending, page, title);
+        return;
     }
 
+    // Get filtered and sorted tasks
+    TaskView tasksToDisplay = taskManager.viewTasksFilteredAndSorted(
+        context, sort_by, ascending, "", priority_filter, status_filter, "", overdue, due_today);
+
     displayTasks(tasksToDisplay, title);
 }
 
@@ -198,7 +231,7 @@ void CommandHandler::handleSearch(const std::vector<std::string> &args)
     if (args.size() < 2)
     {
         std::cerr << "Error: Please provide a search keyword." << std::endl;
-        std::cerr << "Usage: search \"keyword\" [--status pending|in_progress|done] [--priority high|medium|low] [--sort field]" << std::endl;
+        std::cerr << "Usage: search \"keyword\" [--status pending|in_progress|done] [--priority high|medium|low] [--sort field] [--limit N]" << std::endl;
         return;
     }
 
@@ -208,8 +241,18 @@ void CommandHandler::handleSearch(const std::vector<std::string> &args)
     std::string sort_by = findArgument(args, "--sort");
     bool ascending = isAscendingOrder(args);
 
-    std::vector<Task> results = taskManager.getTasksFilteredAndSorted(
-        sort_by, ascending, keyword, priority_filter, status_filter);
+    if (!sort_by.empty() && !FilterUtils::isValidSortSpec(sort_by))
+    {
+        std::cerr << "Error: Invalid sort field. Valid fields: priority, due_date, status, id, created_date" << std::endl;
+        return;
+    }
+
+    FilterUtils::PageRequest page;
+    bool paged = false;
+    if (!parsePageRequest(args, page, paged))
+    {
+        return;
+    }
 
     std::string title = "Search Results for: \"" + keyword + "\"";
     if (!status_filter.empty() || !priority_filter.empty())
@@ -217,6 +260,16 @@ void CommandHandler::handleSearch(const std::vector<std::string> &args)
         title += " (Filtered)";
     }
 
+    if (paged)
+    {
+        displayPage(FilterUtils::compileCriteria(context, keyword, priority_filter, status_filter),
+                    sort_by, ascending, page, title);
+        return;
+    }
+
+    TaskView results = taskManager.viewTasksFilteredAndSorted(
+        context, sort_by, ascending, keyword, priority_filter, status_filter);
+
     displayTasks(results, title);
 }
 
@@ -233,17 +286,36 @@ void CommandHandler::handleFilter(const std::vector<std::string> &args)
     std::string filterType = args[1];
     std::string filterValue = args[2];
 
-    std::vector<Task> results;
+    FilterUtils::PageRequest page;
+    bool paged = false;
+    if (!parsePageRequest(args, page, paged))
+    {
+        return;
+    }
+
+    TaskView results;
     std::string title;
 
     if (filterType == "priority")
     {
-        results = taskManager.getTasksByPriority(filterValue);
+        if (paged)
+        {
+            displayPage(FilterUtils::compileCriteria(context, "", filterValue), "", true, page,
+                        "Tasks with Priority: " + filterValue);
+            return;
+        }
+        results = taskManager.viewTasksByPriority(filterValue);
         title = "Tasks with Priority: " + filterValue;
     }
     else if (filterType == "status")
     {
-        results = taskManager.getTasksByStatus(filterValue);
+        if (paged)
+        {
+            displayPage(FilterUtils::compileCriteria(context, "", "", filterValue), "", true, page,
+                        "Tasks with Status: " + filterValue);
+            return;
+        }
+        results = taskManager.viewTasksByStatus(filterValue);
         title = "Tasks with Status: " + filterValue;
     }
     else
@@ -261,6 +333,7 @@ void CommandHandler::handleSort(const std::vector<std::string> &args)
     {
         std::cerr << "Error: Please provide sort criteria." << std::endl;
         std::cerr << "Usage: sort priority|due_date|status|id|created_date [asc|desc]" << std::endl;
+        std::cerr << "       sort priority:desc,due_date:asc,id" << std::endl;
         return;
     }
 
@@ -276,37 +349,154 @@ void CommandHandler::handleSort(const std::vector<std::string> &args)
         }
     }
 
-    if (!FilterUtils::isValidSortField(sort_by))
+    if (!FilterUtils::isValidSortSpec(sort_by))
     {
         std::cerr << "Error: Invalid sort field. Valid fields: priority, due_date, status, id, created_date" << std::endl;
         return;
     }
 
-    std::vector<Task> results = taskManager.getTasksSorted(sort_by, ascending);
-    std::string title = "All Tasks (Sorted by " + sort_by + (ascending ? " ascending" : " descending") + ")";
+    FilterUtils::PageRequest page;
+    bool paged = false;
+    if (!parsePageRequest(args, page, paged))
+    {
+        return;
+    }
+
+    bool composite = sort_by.find_first_of(",:") != std::string::npos;
+    std::string title = "All Tasks (Sorted by " + sort_by + (composite ? "" : (ascending ? " ascending" : " descending")) + ")";
+
+    if (paged)
+    {
+        displayPage(FilterUtils::TaskPredicate(), sort_by, ascending, page, title);
+        return;
+    }
 
+    TaskView results = taskManager.viewTasksSorted(sort_by, ascending);
     displayTasks(results, title);
 }
 
+void CommandHandler::handleCount(const std::vector<std::string> &args)
+{
+    // An optional leading keyword, then the same filters as list
+    std::string keyword = (args.size() > 1 && args[1].rfind("--", 0) != 0) ? args[1] : "";
+    std::string status_filter = findArgument(args, "--status");
+    std::string priority_filter = findArgument(args, "--priority");
+    std::string due_date = findArgument(args, "--due");
+    bool due_today = hasFlag(args, "--due-today");
+    bool overdue = hasFlag(args, "--overdue");
+
+    if (!due_date.empty() && !DateUtils::isValidDate(due_date))
+    {
+        std::cerr << "Error: Invalid date format. Please use YYYY-MM-DD." << std::endl;
+        return;
+    }
+
+    FilterUtils::TaskPredicate predicate = FilterUtils::compileCriteria(
+        context, keyword, priority_filter, status_filter, due_date, overdue, due_today);
+    std::cout << taskManager.countTasksMatching(predicate) << std::endl;
+}
+
+void CommandHandler::handleStats(const std::vector<std::string> &args)
+{
+    const char *statusNames[] = {"pending", "in_progress", "done"};
+    const char *priorityNames[] = {"low", "medium", "high"};
+
+    const TaskStats &stats = taskManager.getStats();
+    TaskCounts counts = taskManager.countTasks(context);
+    bool json = hasFlag(args, "--json");
+
+    // One "key=value" line per aggregate, or the same data as one JSON object
+    if (!json)
+    {
+        std::cout << "total=" << counts.total << "\n";
+        for (size_t s = 0; s < 3; ++s)
+            std::cout << "status." << statusNames[s] << "=" << counts.byStatus[s] << "\n";
+        for (size_t p = 0; p < 3; ++p)
+            std::cout << "priority." << priorityNames[p] << "=" << counts.byPriority[p] << "\n";
+        for (size_t s = 0; s < 3; ++s)
+        {
+            for (size_t p = 0; p < 3; ++p)
+            {
+                std::cout << "status_priority." << statusNames[s] << "." << priorityNames[p] << "="
+                          << stats.countByStatusAndPriority(static_cast<TaskStatus>(s), static_cast<TaskPriority>(p)) << "\n";
+            }
+        }
+        std::cout << "overdue=" << counts.overdue << "\n";
+        std::cout << "due_today=" << counts.dueToday << "\n";
+        std::cout << "undated=" << stats.countUndated() << "\n";
+        for (const auto &[week, weekCounts] : stats.getDueWeeks())
+        {
+            std::string start = DateUtils::formatDayNumber(week);
+            std::cout << "due_week." << start << "=" << weekCounts.total << "\n";
+            for (size_t s = 0; s < 3; ++s)
+                std::cout << "due_week." << start << "." << statusNames[s] << "=" << weekCounts.byStatus[s] << "\n";
+        }
+        std::cout << std::flush;
+        return;
+    }
+
+    std::cout << "{\"total\":" << counts.total << ",\"status\":{";
+    for (size_t s = 0; s < 3; ++s)
+        std::cout << (s ? "," : "") << "\"" << statusNames[s] << "\":" << counts.byStatus[s];
+    std::cout << "},\"priority\":{";
+    for (size_t p = 0; p < 3; ++p)
+        std::cout << (p ? "," : "") << "\"" << priorityNames[p] << "\":" << counts.byPriority[p];
+    std::cout << "},\"status_priority\":{";
+    for (size_t s = 0; s < 3; ++s)
+    {
+        std::cout << (s ? "," : "") << "\"" << statusNames[s] << "\":{";
+        for (size_t p = 0; p < 3; ++p)
+        {
+            std::cout << (p ? "," : "") << "\"" << priorityNames[p] << "\":"
+                      << stats.countByStatusAndPriority(static_cast<TaskStatus>(s), static_cast<TaskPriority>(p));
+        }
+        std::cout << "}";
+    }
+    std::cout << "},\"overdue\":" << counts.overdue << ",\"due_today\":" << counts.dueToday
+              << ",\"undated\":" << stats.countUndated() << ",\"due_weeks\":[";
+    bool first = true;
+    for (const auto &[week, weekCounts] : stats.getDueWeeks())
+    {
+        std::cout << (first ? "" : ",") << "{\"week\":\"" << DateUtils::formatDayNumber(week)
+                  << "\",\"total\":" << weekCounts.total;
+        for (size_t s = 0; s < 3; ++s)
+            std::cout << ",\"" << statusNames[s] << "\":" << weekCounts.byStatus[s];
+        std::cout << "}";
+        first = false;
+    }
+    std::cout << "]}" << std::endl;
+}
+
 void CommandHandler::handleDue(const std::vector<std::string> &args)
 {
     if (args.size() < 2)
     {
         std::cerr << "Error: Please provide a date or 'today'." << std::endl;
         std::cerr << "Usage: due YYYY-MM-DD" << std::endl;
+        std::cerr << "       due YYYY-MM-DD YYYY-MM-DD" << std::endl;
         std::cerr << "       due today" << std::endl;
         return;
     }
 
     std::string dateArg = args[1];
-    std::vector<Task> results;
+    TaskView results;
     std::string title;
 
     if (dateArg == "today")
     {
-        results = taskManager.getTasksDueToday();
+        results = taskManager.viewTasksDueToday(context);
         title = "Tasks Due Today";
     }
+    else if (args.size() >= 3)
+    {
+        if (!DateUtils::isValidDate(dateArg) || !DateUtils::isValidDate(args[2]))
+        {
+            std::cerr << "Error: Invalid date format. Please use YYYY-MM-DD." << std::endl;
+            return;
+        }
+        results = taskManager.viewTasksDueBetween(dateArg, args[2]);
+        title = "Tasks Due Between: " + dateArg + " and " + args[2];
+    }
     else
     {
         if (!DateUtils::isValidDate(dateArg))
@@ -314,7 +504,7 @@ void CommandHandler::handleDue(const std::vector<std::string> &args)
             std::cerr << "Error: Invalid date format. Please use YYYY-MM-DD." << std::endl;
             return;
         }
-        results = taskManager.getTasksDueBy(dateArg);
+        results = taskManager.viewTasksDueBy(dateArg);
         title = "Tasks Due By: " + dateArg;
     }
 
@@ -323,16 +513,47 @@ void CommandHandler::handleDue(const std::vector<std::string> &args)
 
 void CommandHandler::handleOverdue()
 {
-    std::vector<Task> results = taskManager.getOverdueTasks();
+    TaskView results = taskManager.viewOverdueTasks(context);
     displayTasks(results, "Overdue Tasks");
 }
 
 void CommandHandler::handleToday()
 {
-    std::vector<Task> results = taskManager.getTasksDueToday();
+    TaskView results = taskManager.viewTasksDueToday(context);
     displayTasks(results, "Tasks Due Today");
 }
 
+void CommandHandler::handleExport(const std::vector<std::string> &args)
+{
+    if (args.size() < 2)
+    {
+        std::cerr << "Error: Please provide a file to export to." << std::endl;
+        std::cerr << "Usage: export <file.json|file.bin>" << std::endl;
+        return;
+    }
+
+    if (taskManager.exportTasks(args[1]))
+    {
+        std::cout << "Exported " << taskManager.getTaskCount() << " tasks to " << args[1] << std::endl;
+    }
+}
+
+void CommandHandler::handleImport(const std::vector<std::string> &args)
+{
+    if (args.size() < 2)
+    {
+        std::cerr << "Error: Please provide a file to import from." << std::endl;
+        std::cerr << "Usage: import <file.json|file.bin>" << std::endl;
+        return;
+    }
+
+    int count = taskManager.importTasks(args[1]);
+    if (count >= 0)
+    {
+        std::cout << "Imported " << count << " tasks from " << args[1] << std::endl;
+    }
+}
+
 void CommandHandler::displayHelp()
 {
     std::cout << "Task Tracker - Command Line Task Management Tool (Phase 3)\n"
@@ -353,10 +574,18 @@ void CommandHandler::displayHelp()
     std::cout << "  search \"keyword\" [filters]      Search tasks by keyword with filters" << std::endl;
     std::cout << "  filter <type> <value>           Filter tasks by specific criteria" << std::endl;
     std::cout << "  sort <field> [asc|desc]         Sort all tasks by field" << std::endl;
+    std::cout << "  count [\"keyword\"] [filters]     Print how many tasks match" << std::endl;
+    std::cout << "  stats [--json]                  Print aggregate counts (key=value or JSON)" << std::endl;
     std::cout << "  due <date|today>                Show tasks due by date" << std::endl;
+    std::cout << "  due <from> <to>                 Show tasks due in a date range" << std::endl;
     std::cout << "  overdue                         Show overdue tasks" << std::endl;
     std::cout << "  today                           Show tasks due today" << std::endl;
-    std::cout << "  interactive, -i                 Start interactive mode\n"
+    std::cout << "  export <file>                   Export tasks (.json, or .bin snapshot)" << std::endl;
+    std::cout << "  import <file>                   Import tasks from .json or .bin" << std::endl;
+    std::cout << "  interactive, -i                 Start interactive mode" << std::endl;
+    std::cout << "  batch <file|->                  Run one command per line; saves once (or at \"commit\" lines)" << std::endl;
+    std::cout << "  serve [--socket PATH]           Keep the store loaded and serve commands over a socket" << std::endl;
+    std::cout << "        [--commit-window US]      Batch mutation fsyncs for up to US microseconds (-1: one per mutation)\n"
               << std::endl;
 
     std::cout << "OPTIONS:" << std::endl;
@@ -366,11 +595,16 @@ void CommandHandler::displayHelp()
     std::cout << "  --sort <field> [asc|desc]         Sort results" << std::endl;
     std::cout << "  --description \"text\"              Update description" << std::endl;
     std::cout << "  --due-today                       Filter tasks due today" << std::endl;
-    std::cout << "  --overdue                         Filter overdue tasks\n"
+    std::cout << "  --overdue                         Filter overdue tasks" << std::endl;
+    std::cout << "  --limit <N>                       Show at most N tasks (list, filter, sort, search)" << std::endl;
+    std::cout << "  --offset <N>                      Skip the first N tasks" << std::endl;
+    std::cout << "  --after <cursor>                  Continue after a previous page\n"
               << std::endl;
 
     std::cout << "SORT FIELDS:" << std::endl;
-    std::cout << "  priority, due_date, status, id, created_date\n"
+    std::cout << "  priority, due_date, status, id, created_date" << std::endl;
+    std::cout << "  Combine with commas, each with an optional direction:" << std::endl;
+    std::cout << "  priority:desc,due_date:asc,id   (ties always end in ID order)\n"
               << std::endl;
 
     std::cout << "EXAMPLES:" << std::endl;
@@ -379,10 +613,16 @@ void CommandHandler::displayHelp()
     std::cout << "  task_tracker search \"meeting\" --status pending --sort priority desc" << std::endl;
     std::cout << "  task_tracker sort priority desc" << std::endl;
     std::cout << "  task_tracker list --overdue --sort due_date" << std::endl;
+    std::cout << "  task_tracker list --sort priority:desc,due_date:asc" << std::endl;
+    std::cout << "  task_tracker list --priority high --sort due_date --limit 20" << std::endl;
+    std::cout << "  task_tracker count --status pending --overdue" << std::endl;
     std::cout << "  task_tracker interactive" << std::endl;
+    std::cout << "  task_tracker serve &              (later commands go to the daemon via tasks.json.sock)" << std::endl;
+    std::cout << "  task_tracker batch commands.txt   (or: generate-commands | task_tracker batch -)" << std::endl;
+    std::cout << "  TASK_TRACKER_STORE=tasks.bin task_tracker list   (use a binary store instead of tasks.json)" << std::endl;
 }
 
-void CommandHandler::displayTasks(const std::vector<Task> &tasks, const std::string &title) const
+void CommandHandler::displayTasks(const TaskView &tasks, const std::string &title) const
 {
     if (!title.empty())
     {
@@ -407,41 +647,53 @@ void CommandHandler::displayTasks(const std::vector<Task> &tasks, const std::str
               << std::setw(10) << "Days Left" << std::endl;
     std::cout << std::string(70, '-') << std::endl;
 
-    // Table rows
-    for (const Task &task : tasks)
-    {
-        std::string statusDisplay = getStatusSymbol(task.getStatus()) + " " + task.getStatus();
-        std::string prioritySymbol = getPrioritySymbol(task.getPriority());
-        std::string dueDisplay = task.getDueDate().empty() ? "-" : task.getDueDate();
+    // Table rows are formatted into fixed buffers so rendering does not allocate per task
+    char dueBuffer[11];
+    char daysBuffer[16];
 
-        std::string daysLeft = "-";
-        if (!task.getDueDate().empty())
+    for (const Task *task : tasks)
+    {
+        const char *dueDisplay = "-";
+        const char *daysLeft = "-";
+        if (task->hasDueDate())
         {
-            if (task.isOverdue())
+            DateUtils::formatDayNumber(task->getDueDay(), dueBuffer);
+            dueDisplay = dueBuffer;
+
+            int days = task->getDaysUntilDue(context.today);
+            if (days < 0)
             {
                 daysLeft = "OVERDUE";
             }
-            else if (task.isDueToday())
+            else if (days == 0)
             {
                 daysLeft = "TODAY";
             }
             else
             {
-                int days = task.getDaysUntilDue();
-                if (days >= 0)
-                {
-                    daysLeft = std::to_string(days) + " days";
-                }
+                std::snprintf(daysBuffer, sizeof(daysBuffer), "%d days", days);
+                daysLeft = daysBuffer;
             }
         }
 
         std::cout << std::left
-                  << std::setw(4) << task.getId()
-                  << std::setw(3) << prioritySymbol
-                  << std::setw(25) << (task.getDescription().length() > 24 ? task.getDescription().substr(0, 21) + "..." : task.getDescription())
-                  << std::setw(15) << statusDisplay
+                  << std::setw(4) << task->getId()
+                  << std::setw(3) << getPrioritySymbol(task->getPriorityCode());
+
+        std::string_view description = task->getDescription();
+        if (description.length() > 24)
+        {
+            std::cout << description.substr(0, 21) << "... ";
+        }
+        else
+        {
+            std::cout << std::setw(25) << description;
+        }
+
+        std::cout << getStatusSymbol(task->getStatusCode()) << ' '
+                  << std::setw(11) << task->getStatus()
                   << std::setw(12) << dueDisplay
-                  << std::setw(10) << daysLeft << std::endl;
+                  << std::setw(10) << daysLeft << '\n';
     }
 
     std::cout << "\nLegend: [!] High Priority, [>] Medium Priority, [-] Low Priority" << std::endl;
@@ -457,6 +709,9 @@ void CommandHandler::processCommand(const std::vector<std::string> &args)
         return;
     }
 
+    // One clock read per command; every filter and row below uses it
+    context = QueryContext::capture();
+
     std::string command = args[0];
 
     if (command == "add")
@@ -499,6 +754,14 @@ void CommandHandler::processCommand(const std::vector<std::string> &args)
     {
         handleDue(args);
     }
+    else if (command == "count")
+    {
+        handleCount(args);
+    }
+    else if (command == "stats")
+    {
+        handleStats(args);
+    }
     else if (command == "overdue")
     {
         handleOverdue();
@@ -507,6 +770,14 @@ void CommandHandler::processCommand(const std::vector<std::string> &args)
     {
         handleToday();
     }
+    else if (command == "export")
+    {
+        handleExport(args);
+    }
+    else if (command == "import")
+    {
+        handleImport(args);
+    }
     else if (command == "help" || command == "--help" || command == "-h")
     {
         displayHelp();
@@ -518,6 +789,56 @@ void CommandHandler::processCommand(const std::vector<std::string> &args)
     }
 }
 
+void CommandHandler::displayPage(const FilterUtils::TaskPredicate &predicate, const std::string &sort_by,
+                                 bool ascending, const FilterUtils::PageRequest &page,
+                                 const std::string &title) const
+{
+    std::vector<FilterUtils::SortKey> keys;
+    if (!sort_by.empty())
+    {
+        FilterUtils::parseSortSpec(sort_by, ascending, keys);
+    }
+
+    FilterUtils::TaskPage result;
+    if (!taskManager.viewTasksPage(predicate, keys, page, result))
+    {
+        std::cerr << "Error: Invalid cursor for this sort order: " << page.after << std::endl;
+        return;
+    }
+
+    displayTasks(result.tasks, title);
+    if (result.has_more)
+    {
+        std::cout << "More tasks: --after " << result.next_cursor << std::endl;
+    }
+}
+
+bool CommandHandler::parsePageRequest(const std::vector<std::string> &args, FilterUtils::PageRequest &page,
+                                      bool &paged) const
+{
+    std::string limit = findArgument(args, "--limit");
+    std::string offset = findArgument(args, "--offset");
+    page.after = findArgument(args, "--after");
+    paged = hasFlag(args, "--limit") || hasFlag(args, "--offset") || hasFlag(args, "--after");
+
+    if (hasFlag(args, "--limit") && (!parseCount(limit, page.limit) || page.limit == 0))
+    {
+        std::cerr << "Error: --limit needs a positive number." << std::endl;
+        return false;
+    }
+    if (hasFlag(args, "--offset") && !parseCount(offset, page.offset))
+    {
+        std::cerr << "Error: --offset needs a non-negative number." << std::endl;
+        return false;
+    }
+    if (hasFlag(args, "--after") && page.after.empty())
+    {
+        std::cerr << "Error: --after needs a cursor from a previous page." << std::endl;
+        return false;
+    }
+    return true;
+}
+
 // Helper functions
 std::string CommandHandler::findArgument(const std::vector<std::string> &args, const std::string &flag) const
 {
@@ -534,23 +855,31 @@ bool CommandHandler::hasFlag(const std::vector<std::string> &args, const std::st
     return std::find(args.begin(), args.end(), flag) != args.end();
 }
 
-std::string CommandHandler::getPrioritySymbol(const std::string &priority) const
+const char *CommandHandler::getPrioritySymbol(TaskPriority priority) const
 {
-    if (priority == "high")
+    switch (priority)
+    {
+    case TaskPriority::High:
         return "[!]";
-    if (priority == "medium")
+    case TaskPriority::Medium:
         return "[>]";
-    if (priority == "low")
+    case TaskPriority::Low:
         return "[-]";
+    }
     return "[ ]";
 }
 
-std::string CommandHandler::getStatusSymbol(const std::string &status) const
+const char *CommandHandler::getStatusSymbol(TaskStatus status) const
 {
-    if (status == "done")
+    switch (status)
+    {
+    case TaskStatus::Done:
         return "[X]";
-    if (status == "in_progress")
+    case TaskStatus::InProgress:
         return "[>]";
+    case TaskStatus::Pending:
+        break;
+    }
     return "[ ]";
 }
 
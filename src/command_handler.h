@@ -4,11 +4,13 @@
 #include <vector>
 #include <string>
 #include "task_manager.h"
+#include "query_context.h"
 
 class CommandHandler
 {
 private:
     TaskManager &taskManager;
+    QueryContext context; // Captured at the start of each command
 
 public:
     explicit CommandHandler(TaskManager &tm);
@@ -26,12 +28,16 @@ public:
     void handleFilter(const std::vector<std::string> &args);
     void handleSort(const std::vector<std::string> &args);
     void handleDue(const std::vector<std::string> &args);
+    void handleCount(const std::vector<std::string> &args);
+    void handleStats(const std::vector<std::string> &args);
     void handleOverdue();
     void handleToday();
+    void handleExport(const std::vector<std::string> &args);
+    void handleImport(const std::vector<std::string> &args);
 
     // Utility
-    void displayHelp();
-    void displayTasks(const std::vector<Task> &tasks, const std::string &title = "") const;
+    static void displayHelp();
+    void displayTasks(const TaskView &tasks, const std::string &title = "") const;
 
     // Main command processor
     void processCommand(const std::vector<std::string> &args);
@@ -40,9 +46,14 @@ private:
     // Helper functions for argument parsing
     std::string findArgument(const std::vector<std::string> &args, const std::string &flag) const;
     bool hasFlag(const std::vector<std::string> &args, const std::string &flag) const;
-    std::string getPrioritySymbol(const std::string &priority) const;
-    std::string getStatusSymbol(const std::string &status) const;
+    const char *getPrioritySymbol(TaskPriority priority) const;
+    const char *getStatusSymbol(TaskStatus status) const;
     bool isAscendingOrder(const std::vector<std::string> &args) const;
+
+    // --limit/--offset/--after; false (with a message) if any is malformed
+    bool parsePageRequest(const std::vector<std::string> &args, FilterUtils::PageRequest &page, bool &paged) const;
+    void displayPage(const FilterUtils::TaskPredicate &predicate, const std::string &sort_by, bool ascending,
+                     const FilterUtils::PageRequest &page, const std::string &title) const;
 };
 
 #endif
\ No newline at end of file
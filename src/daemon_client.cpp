@@ -0,0 +1,116 @@
+#include "daemon_client.h"
+#include "wire_protocol.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace DaemonClient
+{
+    namespace
+    {
+        int connectTo(const std::string &socketPath)
+        {
+            // Checking for the socket file first keeps the no-daemon case to one stat
+            struct stat info;
+            if (::stat(socketPath.c_str(), &info) != 0 || !S_ISSOCK(info.st_mode))
+                return -1;
+
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            if (socketPath.size() >= sizeof(address.sun_path))
+                return -1;
+            std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size() + 1);
+
+            int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+            if (fd < 0)
+                return -1;
+            if (::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0)
+            {
+                ::close(fd); // Stale socket file from a daemon that is gone
+                return -1;
+            }
+            return fd;
+        }
+
+        // Prints each part of one response as it arrives
+        bool relayResponse(int fd, std::string &buffer)
+        {
+            std::string payload, out, err;
+            bool more = true;
+            while (more)
+            {
+                if (!WireProtocol::readFrame(fd, payload, buffer) ||
+                    !WireProtocol::decodeResponse(payload, out, err, more))
+                    return false;
+                std::cout << out << std::flush;
+                std::cerr << err << std::flush;
+            }
+            return true;
+        }
+    }
+
+    ForwardResult forward(const std::string &socketPath, const std::vector<std::string> &args)
+    {
+        int fd = connectTo(socketPath);
+        if (fd < 0)
+            return ForwardResult::NoDaemon;
+
+        std::string buffer;
+        bool ok = WireProtocol::writeAll(fd, WireProtocol::encodeRequest(args)) && relayResponse(fd, buffer);
+        ::close(fd);
+
+        if (!ok)
+        {
+            std::cerr << "Error: Lost connection to the daemon on " << socketPath
+                      << "; the command may or may not have run." << std::endl;
+            return ForwardResult::Failed;
+        }
+        return ForwardResult::Forwarded;
+    }
+
+    ForwardResult forwardAll(const std::string &socketPath, const std::vector<std::vector<std::string>> &commands)
+    {
+        int fd = connectTo(socketPath);
+        if (fd < 0)
+            return ForwardResult::NoDaemon;
+
+        // Pipelined, but bounded so neither side's buffers grow without limit
+        const size_t WINDOW = 64;
+        std::string requests, buffer;
+        bool ok = true;
+        for (size_t begin = 0; ok && begin < commands.size(); begin += WINDOW)
+        {
+            size_t end = std::min(commands.size(), begin + WINDOW);
+            requests.clear();
+            for (size_t i = begin; i < end; ++i)
+            {
+                requests += WireProtocol::encodeRequest(commands[i]);
+            }
+            ok = WireProtocol::writeAll(fd, requests);
+            for (size_t i = begin; ok && i < end; ++i)
+            {
+                ok = relayResponse(fd, buffer);
+            }
+        }
+        ::close(fd);
+
+        if (!ok)
+        {
+            std::cerr << "Error: Lost connection to the daemon on " << socketPath
+                      << "; later commands in the batch may not have run." << std::endl;
+            return ForwardResult::Failed;
+        }
+        return ForwardResult::Forwarded;
+    }
+
+    std::string defaultSocketPath(const std::string &storePath)
+    {
+        const char *path = std::getenv("TASK_TRACKER_SOCKET");
+        return (path && *path) ? path : storePath + ".sock";
+    }
+}
@@ -0,0 +1,29 @@
+#ifndef DAEMON_CLIENT_H
+#define DAEMON_CLIENT_H
+
+#include <string>
+#include <vector>
+
+// Thin CLI side of the daemon (see server.h): sends one command and prints
+// the daemon's captured output as if the command had run locally.
+namespace DaemonClient
+{
+    enum class ForwardResult
+    {
+        NoDaemon,  // Nothing listening; run the command locally
+        Forwarded, // Output printed
+        Failed     // Connection lost mid-command; running it again could repeat a mutation
+    };
+
+    ForwardResult forward(const std::string &socketPath, const std::vector<std::string> &args);
+
+    // Sends many commands over one connection, a window at a time, and
+    // prints each reply in order
+    ForwardResult forwardAll(const std::string &socketPath, const std::vector<std::vector<std::string>> &commands);
+
+    // $TASK_TRACKER_SOCKET, or the store path plus ".sock" (tasks.json.sock),
+    // so a client only reaches a daemon serving the store it would load
+    std::string defaultSocketPath(const std::string &storePath);
+}
+
+#endif
@@ -1,38 +1,88 @@
 #include "date_utils.h"
+#include <algorithm>
 #include <chrono>
+#include <ctime>
 #include <iomanip>
 #include <sstream>
-#include <regex>
 
 namespace DateUtils
 {
-
-    bool isValidDate(const std::string &date_str)
+    namespace
     {
-        int year, month, day;
-        if (!parseDateString(date_str, year, month, day))
+        constexpr bool parsesTo(std::string_view text, int y, int m, int d)
         {
-            return false;
+            int year = 0, month = 0, day = 0;
+            return parseDate(text, year, month, day) && year == y && month == m && day == d;
         }
 
-        // Check basic ranges
-        if (year < 1900 || year > 2100)
-            return false;
-        if (month < 1 || month > 12)
-            return false;
-        if (day < 1)
-            return false;
+        static_assert(parsesTo("2025-06-15", 2025, 6, 15));
+        static_assert(!parsesTo("2025-6-15", 2025, 6, 15));
+        static_assert(isValidDate(2024, 2, 29) && !isValidDate(2023, 2, 29));
+
+        constexpr bool roundTrips(int32_t day_number)
+        {
+            int year = 0, month = 0, day = 0;
+            fromDayNumber(day_number, year, month, day);
+            return toDayNumber(year, month, day) == day_number;
+        }
+
+        static_assert(toDayNumber(1970, 1, 1) == 0);
+        static_assert(toDayNumber(2000, 3, 1) - toDayNumber(2000, 2, 28) == 2);
+        static_assert(roundTrips(-25567) && roundTrips(0) && roundTrips(20254) && roundTrips(47482));
+
+        // Little-endian word of the first eight bytes (compiles to a single load)
+        constexpr uint64_t loadWord(const char *bytes)
+        {
+            uint64_t word = 0;
+            for (int i = 0; i < 8; ++i)
+            {
+                word |= static_cast<uint64_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+            }
+            return word;
+        }
+
+        constexpr uint64_t DATE_PATTERN = loadWord("0000-00-");
+        constexpr uint64_t HIGH_BITS = 0x8080808080808080ULL;
+        constexpr uint64_t HYPHEN_BYTES = 0xFF0000FF00000000ULL;
 
-        // Check days in month
-        int daysInMonth = getDaysInMonth(month, year);
-        return day <= daysInMonth;
+        // YYYY-MM-DD checked eight bytes at a time: XOR against the pattern turns
+        // digits into 0-9 and correct hyphens into 0, then one add-and-mask
+        // rejects any byte above 9.
+        inline bool parseDateWord(std::string_view date_str, int &year, int &month, int &day)
+        {
+            if (date_str.size() != 10)
+                return false;
+
+            uint64_t word = loadWord(date_str.data()) ^ DATE_PATTERN;
+            unsigned d8 = static_cast<unsigned char>(date_str[8]) - static_cast<unsigned>('0');
+            unsigned d9 = static_cast<unsigned char>(date_str[9]) - static_cast<unsigned>('0');
+
+            bool shapeOk = ((word | (word + 0x7676767676767676ULL)) & HIGH_BITS) == 0 &&
+                           (word & HYPHEN_BYTES) == 0 && d8 <= 9 && d9 <= 9;
+            if (!shapeOk)
+                return false;
+
+            auto digit = [word](int index)
+            { return static_cast<int>((word >> (8 * index)) & 0xFF); };
+            year = digit(0) * 1000 + digit(1) * 100 + digit(2) * 10 + digit(3);
+            month = digit(5) * 10 + digit(6);
+            day = static_cast<int>(d8 * 10 + d9);
+            return true;
+        }
+    }
+
+    bool isValidDate(const std::string &date_str)
+    {
+        int year, month, day;
+        return parseDate(date_str, year, month, day) && isValidDate(year, month, day);
     }
 
     std::string getCurrentDate()
     {
         auto now = std::chrono::system_clock::now();
         auto time_t = std::chrono::system_clock::to_time_t(now);
-        auto tm = *std::localtime(&time_t);
+        std::tm tm{};
+        localtime_r(&time_t, &tm); // Reentrant: readers may run on several threads
 
         std::stringstream ss;
         ss << std::put_time(&tm, "%Y-%m-%d");
@@ -47,27 +97,13 @@ namespace DateUtils
 
     int daysBetween(const std::string &date1_str, const std::string &date2_str)
     {
-        int year1, month1, day1, year2, month2, day2;
-
-        if (!parseDateString(date1_str, year1, month1, day1) ||
-            !parseDateString(date2_str, year2, month2, day2))
+        int32_t day1 = toDayNumber(date1_str);
+        int32_t day2 = toDayNumber(date2_str);
+        if (day1 == NO_DATE || day2 == NO_DATE)
         {
             return 0;
         }
-
-        // Convert to days since epoch (simplified calculation)
-        auto date1 = std::chrono::year_month_day{std::chrono::year{year1},
-                                                 std::chrono::month{static_cast<unsigned>(month1)},
-                                                 std::chrono::day{static_cast<unsigned>(day1)}};
-        auto date2 = std::chrono::year_month_day{std::chrono::year{year2},
-                                                 std::chrono::month{static_cast<unsigned>(month2)},
-                                                 std::chrono::day{static_cast<unsigned>(day2)}};
-
-        // Simple day calculation (not accounting for all edge cases)
-        int days1 = year1 * 365 + month1 * 30 + day1;
-        int days2 = year2 * 365 + month2 * 30 + day2;
-
-        return days2 - days1;
+        return day2 - day1;
     }
 
     bool isDateBefore(const std::string &date1_str, const std::string &date2_str)
@@ -80,103 +116,97 @@ namespace DateUtils
         return date1_str == date2_str;
     }
 
-    bool isLeapYear(int year)
+    bool parseDateString(const std::string &date_str, int &year, int &month, int &day)
     {
-        return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+        return parseDate(date_str, year, month, day);
     }
 
-    int getDaysInMonth(int month, int year)
+    bool isDateInRange(const std::string &date_str, const std::string &start_date, const std::string &end_date)
     {
-        switch (month)
+        int32_t day = toDayNumber(date_str);
+        int32_t start = toDayNumber(start_date);
+        int32_t end = toDayNumber(end_date);
+        if (day == NO_DATE || start == NO_DATE || end == NO_DATE)
         {
-        case 1:
-        case 3:
-        case 5:
-        case 7:
-        case 8:
-        case 10:
-        case 12:
-            return 31;
-        case 4:
-        case 6:
-        case 9:
-        case 11:
-            return 30;
-        case 2:
-            return isLeapYear(year) ? 29 : 28;
-        default:
-            return 0;
+            return false;
         }
+        return start <= day && day <= end;
     }
 
-    bool parseDateString(const std::string &date_str, int &year, int &month, int &day)
+    std::string addDays(const std::string &date_str, int days)
     {
-        // Expected format: YYYY-MM-DD
-        std::regex date_regex(R"((\d{4})-(\d{2})-(\d{2}))");
-        std::smatch matches;
-
-        if (!std::regex_match(date_str, matches, date_regex))
+        int year, month, day;
+        if (!parseDate(date_str, year, month, day) || !isValidDate(year, month, day))
         {
-            return false;
+            return date_str;
         }
 
-        try
-        {
-            year = std::stoi(matches[1]);
-            month = std::stoi(matches[2]);
-            day = std::stoi(matches[3]);
-            return true;
-        }
-        catch (const std::exception &)
-        {
-            return false;
-        }
+        char buffer[11];
+        formatDayNumber(toDayNumber(year, month, day) + days, buffer);
+        return std::string(buffer);
     }
 
-    bool isDateInRange(const std::string &date_str, const std::string &start_date, const std::string &end_date)
+    int32_t toDayNumber(std::string_view date_str)
     {
-        return (isDateEqual(date_str, start_date) || isDateBefore(start_date, date_str)) &&
-               (isDateEqual(date_str, end_date) || isDateBefore(date_str, end_date));
+        int year, month, day;
+        if (!parseDate(date_str, year, month, day) || !isValidDate(year, month, day))
+        {
+            return NO_DATE;
+        }
+        return toDayNumber(year, month, day);
     }
 
-    std::string addDays(const std::string &date_str, int days)
+    size_t toDayNumbers(std::span<const std::string_view> dates, std::span<int32_t> days)
     {
-        int year, month, day;
-        if (!parseDateString(date_str, year, month, day))
+        size_t invalid = 0;
+        size_t count = std::min(dates.size(), days.size());
+        for (size_t i = 0; i < count; ++i)
         {
-            return date_str;
+            int year = 0, month = 0, day = 0;
+            bool valid = parseDateWord(dates[i], year, month, day) && isValidDate(year, month, day);
+            days[i] = valid ? toDayNumber(year, month, day) : NO_DATE;
+            invalid += (!valid && !dates[i].empty()) ? 1 : 0;
         }
+        return invalid;
+    }
 
-        // Simple implementation - add days and handle month/year overflow
-        day += days;
+    std::string formatDayNumber(int32_t day_number)
+    {
+        char buffer[11];
+        formatDayNumber(day_number, buffer);
+        return std::string(buffer);
+    }
 
-        while (day > getDaysInMonth(month, year))
+    void formatDayNumber(int32_t day_number, char (&buffer)[11])
+    {
+        if (day_number == DateUtils::NO_DATE)
         {
-            day -= getDaysInMonth(month, year);
-            month++;
-            if (month > 12)
-            {
-                month = 1;
-                year++;
-            }
+            buffer[0] = '\0';
+            return;
         }
 
-        while (day < 1)
-        {
-            month--;
-            if (month < 1)
-            {
-                month = 12;
-                year--;
-            }
-            day += getDaysInMonth(month, year);
-        }
+        int year, month, day;
+        fromDayNumber(day_number, year, month, day);
+
+        buffer[0] = static_cast<char>('0' + (year / 1000) % 10);
+        buffer[1] = static_cast<char>('0' + (year / 100) % 10);
+        buffer[2] = static_cast<char>('0' + (year / 10) % 10);
+        buffer[3] = static_cast<char>('0' + year % 10);
+        buffer[4] = '-';
+        buffer[5] = static_cast<char>('0' + month / 10);
+        buffer[6] = static_cast<char>('0' + month % 10);
+        buffer[7] = '-';
+        buffer[8] = static_cast<char>('0' + day / 10);
+        buffer[9] = static_cast<char>('0' + day % 10);
+        buffer[10] = '\0';
+    }
 
-        std::stringstream ss;
-        ss << std::setfill('0') << std::setw(4) << year << "-"
-           << std::setw(2) << month << "-"
-           << std::setw(2) << day;
-        return ss.str();
+    int32_t getCurrentDayNumber()
+    {
+        auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+        std::tm tm{};
+        localtime_r(&now, &tm);
+        return toDayNumber(tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday);
     }
 
-}
\ No newline at end of file
+}
@@ -1,25 +1,108 @@
 #ifndef DATE_UTILS_H
 #define DATE_UTILS_H
 
+#include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 
 namespace DateUtils
 {
     bool isValidDate(const std::string &date_str);
     std::string getCurrentDate();
     std::string formatDate(const std::string &date_str);
-    int daysBetween(const std::string &date1_str, const std::string &date2_str);
+    int daysBetween(const std::string &date1_str, const std::string &date2_str); // date2 - date1
     bool isDateBefore(const std::string &date1_str, const std::string &date2_str);
     bool isDateEqual(const std::string &date1_str, const std::string &date2_str);
 
     // Helper functions
-    bool isLeapYear(int year);
-    int getDaysInMonth(int month, int year);
+    constexpr bool isLeapYear(int year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || (year % 400 == 0);
+    }
+
+    constexpr int getDaysInMonth(int month, int year)
+    {
+        constexpr int DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        if (month < 1 || month > 12)
+            return 0;
+        return (month == 2 && isLeapYear(year)) ? 29 : DAYS[month - 1];
+    }
+
+    // Fixed-width YYYY-MM-DD: checks the shape only, not the calendar
+    constexpr bool parseDate(std::string_view date_str, int &year, int &month, int &day)
+    {
+        if (date_str.size() != 10 || date_str[4] != '-' || date_str[7] != '-')
+            return false;
+
+        // Accumulate every digit check before branching once
+        unsigned bad = 0;
+        int digits[8] = {};
+        constexpr int POSITIONS[] = {0, 1, 2, 3, 5, 6, 8, 9};
+        for (int i = 0; i < 8; ++i)
+        {
+            unsigned digit = static_cast<unsigned>(date_str[POSITIONS[i]]) - '0';
+            bad |= digit > 9 ? 1u : 0u;
+            digits[i] = static_cast<int>(digit);
+        }
+        if (bad)
+            return false;
+
+        year = digits[0] * 1000 + digits[1] * 100 + digits[2] * 10 + digits[3];
+        month = digits[4] * 10 + digits[5];
+        day = digits[6] * 10 + digits[7];
+        return true;
+    }
+
+    // Calendar check with the supported year range (1900-2100)
+    constexpr bool isValidDate(int year, int month, int day)
+    {
+        return year >= 1900 && year <= 2100 && day >= 1 && day <= getDaysInMonth(month, year);
+    }
+
     bool parseDateString(const std::string &date_str, int &year, int &month, int &day);
 
     // Date range utilities
     bool isDateInRange(const std::string &date_str, const std::string &start_date, const std::string &end_date);
     std::string addDays(const std::string &date_str, int days);
+
+    // Day numbers: days since 1970-01-01 (proleptic Gregorian). Every other
+    // date operation reduces to these two conversions and integer arithmetic.
+    const int32_t NO_DATE = INT32_MIN;
+
+    // Howard Hinnant's days_from_civil
+    constexpr int32_t toDayNumber(int year, int month, int day)
+    {
+        year -= month <= 2;
+        const int era = (year >= 0 ? year : year - 399) / 400;
+        const unsigned yoe = static_cast<unsigned>(year - era * 400);
+        const unsigned doy = (153 * static_cast<unsigned>(month + (month > 2 ? -3 : 9)) + 2) / 5 + static_cast<unsigned>(day) - 1;
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + static_cast<int32_t>(doe) - 719468;
+    }
+
+    // Howard Hinnant's civil_from_days
+    constexpr void fromDayNumber(int32_t day_number, int &year, int &month, int &day)
+    {
+        day_number += 719468;
+        const int era = (day_number >= 0 ? day_number : day_number - 146096) / 146097;
+        const unsigned doe = static_cast<unsigned>(day_number - era * 146097);
+        const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const unsigned mp = (5 * doy + 2) / 153;
+        day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+        month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+        year = static_cast<int>(yoe) + era * 400 + (month <= 2);
+    }
+
+    int32_t toDayNumber(std::string_view date_str); // NO_DATE if empty or invalid
+
+    // Converts a column of date strings at once. Empty and invalid entries
+    // become NO_DATE; returns how many non-empty entries were invalid.
+    size_t toDayNumbers(std::span<const std::string_view> dates, std::span<int32_t> days);
+    std::string formatDayNumber(int32_t day_number);   // "" for NO_DATE
+    void formatDayNumber(int32_t day_number, char (&buffer)[11]); // No allocation
+    int32_t getCurrentDayNumber();
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+#include "due_index.h"
+#include <algorithm>
+#include <limits>
+
+void DueIndex::insert(int32_t day, int id)
+{
+    Entry entry{day, id};
+    auto it = std::lower_bound(entries.begin(), entries.end(), entry);
+    if (it == entries.end() || it->day != day || it->id != id)
+    {
+        entries.insert(it, entry);
+    }
+}
+
+void DueIndex::erase(int32_t day, int id)
+{
+    Entry entry{day, id};
+    auto it = std::lower_bound(entries.begin(), entries.end(), entry);
+    if (it != entries.end() && it->day == day && it->id == id)
+    {
+        entries.erase(it);
+    }
+}
+
+void DueIndex::assign(std::vector<Entry> unsorted)
+{
+    entries = std::move(unsorted);
+    std::sort(entries.begin(), entries.end());
+}
+
+void DueIndex::clear()
+{
+    entries.clear();
+}
+
+std::span<const DueIndex::Entry> DueIndex::range(int32_t first, int32_t last) const
+{
+    if (first > last)
+        return {};
+
+    auto begin = std::lower_bound(entries.begin(), entries.end(),
+                                  Entry{first, std::numeric_limits<int>::min()});
+    auto end = std::upper_bound(begin, entries.end(),
+                                Entry{last, std::numeric_limits<int>::max()});
+    return std::span<const Entry>(entries.data() + (begin - entries.begin()),
+                                  static_cast<size_t>(end - begin));
+}
+
+size_t DueIndex::countInRange(int32_t first, int32_t last) const
+{
+    return range(first, last).size();
+}
+
+size_t DueIndex::size() const
+{
+    return entries.size();
+}
@@ -0,0 +1,42 @@
+#ifndef DUE_INDEX_H
+#define DUE_INDEX_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Tasks with a due date, ordered by (due day, ID) in one sorted array.
+//
+// A date query is a binary search for each end of the range followed by a
+// walk over the contiguous entries in between. Tasks without a due date are
+// not indexed.
+class DueIndex
+{
+public:
+    struct Entry
+    {
+        int32_t day;
+        int id;
+
+        bool operator<(const Entry &other) const
+        {
+            return day != other.day ? day < other.day : id < other.id;
+        }
+    };
+
+private:
+    std::vector<Entry> entries;
+
+public:
+    void insert(int32_t day, int id);
+    void erase(int32_t day, int id);
+    void assign(std::vector<Entry> unsorted); // Bulk build: one sort
+    void clear();
+
+    // Entries due in [first, last], ordered by day
+    std::span<const Entry> range(int32_t first, int32_t last) const;
+    size_t countInRange(int32_t first, int32_t last) const;
+    size_t size() const;
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include "durable_file.h"
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace DurableFile
+{
+    bool writeAll(int fd, std::string_view data)
+    {
+        size_t written = 0;
+        while (written < data.size())
+        {
+            ssize_t n = ::write(fd, data.data() + written, data.size() - written);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            written += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool syncDirectory(const std::string &path)
+    {
+        size_t slash = path.find_last_of('/');
+        std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+
+        int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+        bool synced = ::fsync(fd) == 0;
+        return ::close(fd) == 0 && synced;
+    }
+
+    bool replace(const std::string &path, std::initializer_list<std::string_view> parts)
+    {
+        std::string tempPath = path + ".tmp";
+        int fd = ::open(tempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        if (fd < 0)
+            return false;
+
+        bool written = true;
+        for (std::string_view part : parts)
+        {
+            written = written && writeAll(fd, part);
+        }
+        written = ::fsync(fd) == 0 && written;
+        written = ::close(fd) == 0 && written;
+
+        if (!written || std::rename(tempPath.c_str(), path.c_str()) != 0)
+        {
+            std::remove(tempPath.c_str());
+            return false;
+        }
+        return syncDirectory(path);
+    }
+}
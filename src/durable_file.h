@@ -0,0 +1,23 @@
+#ifndef DURABLE_FILE_H
+#define DURABLE_FILE_H
+
+#include <initializer_list>
+#include <string>
+#include <string_view>
+
+// Crash-safe file replacement. A file is only durable once its data is
+// fsync'ed, and a rename (or a newly created name) only once its directory is.
+namespace DurableFile
+{
+    // Writes parts to path.tmp, fsyncs it, renames it over path and fsyncs the
+    // directory. On failure path is untouched and false is returned.
+    bool replace(const std::string &path, std::initializer_list<std::string_view> parts);
+
+    // Fsyncs the directory holding path, making its entries durable
+    bool syncDirectory(const std::string &path);
+
+    // Writes all of data to fd, retrying short writes
+    bool writeAll(int fd, std::string_view data);
+}
+
+#endif
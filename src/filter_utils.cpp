@@ -1,20 +1,50 @@
 #include "filter_utils.h"
 #include "date_utils.h"
 #include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <iostream>
 
 namespace FilterUtils
 {
 
-    std::vector<Task> filterByKeyword(const std::vector<Task> &tasks, const std::string &keyword)
+    TaskView viewOf(const std::vector<Task> &tasks)
+    {
+        TaskView view;
+        view.reserve(tasks.size());
+        for (const Task &task : tasks)
+        {
+            view.push_back(&task);
+        }
+        return view;
+    }
+
+    std::vector<Task> materialize(const TaskView &view)
+    {
+        std::vector<Task> tasks;
+        tasks.reserve(view.size());
+        for (const Task *task : view)
+        {
+            tasks.push_back(*task);
+        }
+        return tasks;
+    }
+
+    TaskView filterByKeyword(const TaskView &tasks, const std::string &keyword)
     {
         if (keyword.empty())
             return tasks;
 
-        std::vector<Task> filtered;
-        for (const Task &task : tasks)
+        // Lowercase the keyword once; descriptions are compared in place
+        std::string keyword_lower = keyword;
+        std::transform(keyword_lower.begin(), keyword_lower.end(), keyword_lower.begin(),
+                       [](unsigned char c)
+                       { return static_cast<char>(std::tolower(c)); });
+
+        TaskView filtered;
+        for (const Task *task : tasks)
         {
-            if (task.matchesKeyword(keyword))
+            if (task->matchesLowercaseKeyword(keyword_lower))
             {
                 filtered.push_back(task);
             }
@@ -22,15 +52,19 @@ namespace FilterUtils
         return filtered;
     }
 
-    std::vector<Task> filterByPriority(const std::vector<Task> &tasks, const std::string &priority)
+    TaskView filterByPriority(const TaskView &tasks, const std::string &priority)
     {
         if (priority.empty())
             return tasks;
 
-        std::vector<Task> filtered;
-        for (const Task &task : tasks)
+        TaskView filtered;
+        TaskPriority code;
+        if (!Task::parsePriority(priority, code))
+            return filtered;
+
+        for (const Task *task : tasks)
         {
-            if (task.getPriority() == priority)
+            if (task->getPriorityCode() == code)
             {
                 filtered.push_back(task);
             }
@@ -38,15 +72,19 @@ namespace FilterUtils
         return filtered;
     }
 
-    std::vector<Task> filterByStatus(const std::vector<Task> &tasks, const std::string &status)
+    TaskView filterByStatus(const TaskView &tasks, const std::string &status)
     {
         if (status.empty())
             return tasks;
 
-        std::vector<Task> filtered;
-        for (const Task &task : tasks)
+        TaskView filtered;
+        TaskStatus code;
+        if (!Task::parseStatus(status, code))
+            return filtered;
+
+        for (const Task *task : tasks)
         {
-            if (task.getStatus() == status)
+            if (task->getStatusCode() == code)
             {
                 filtered.push_back(task);
             }
@@ -54,17 +92,21 @@ namespace FilterUtils
         return filtered;
     }
 
-    std::vector<Task> filterByDateRange(const std::vector<Task> &tasks,
-                                        const std::string &start_date, const std::string &end_date)
+    TaskView filterByDateRange(const TaskView &tasks,
+                               const std::string &start_date, const std::string &end_date)
     {
         if (start_date.empty() || end_date.empty())
             return tasks;
 
-        std::vector<Task> filtered;
-        for (const Task &task : tasks)
+        TaskView filtered;
+        int32_t start = DateUtils::toDayNumber(start_date);
+        int32_t end = DateUtils::toDayNumber(end_date);
+        if (start == DateUtils::NO_DATE || end == DateUtils::NO_DATE)
+            return filtered;
+
+        for (const Task *task : tasks)
         {
-            if (!task.getDueDate().empty() &&
-                DateUtils::isDateInRange(task.getDueDate(), start_date, end_date))
+            if (task->hasDueDate() && task->getDueDay() >= start && task->getDueDay() <= end)
             {
                 filtered.push_back(task);
             }
@@ -72,15 +114,19 @@ namespace FilterUtils
         return filtered;
     }
 
-    std::vector<Task> filterByDueDate(const std::vector<Task> &tasks, const std::string &due_date)
+    TaskView filterByDueDate(const TaskView &tasks, const std::string &due_date)
     {
         if (due_date.empty())
             return tasks;
 
-        std::vector<Task> filtered;
-        for (const Task &task : tasks)
+        TaskView filtered;
+        int32_t day = DateUtils::toDayNumber(due_date);
+        if (day == DateUtils::NO_DATE)
+            return filtered;
+
+        for (const Task *task : tasks)
         {
-            if (task.getDueDate() == due_date)
+            if (task->getDueDay() == day)
             {
                 filtered.push_back(task);
             }
@@ -88,12 +134,12 @@ namespace FilterUtils
         return filtered;
     }
 
-    std::vector<Task> filterOverdue(const std::vector<Task> &tasks)
+    TaskView filterOverdue(const TaskView &tasks, const QueryContext &context)
     {
-        std::vector<Task> filtered;
-        for (const Task &task : tasks)
+        TaskView filtered;
+        for (const Task *task : tasks)
         {
-            if (task.isOverdue())
+            if (task->isOverdue(context.today))
             {
                 filtered.push_back(task);
             }
@@ -101,12 +147,12 @@ namespace FilterUtils
         return filtered;
     }
 
-    std::vector<Task> filterDueToday(const std::vector<Task> &tasks)
+    TaskView filterDueToday(const TaskView &tasks, const QueryContext &context)
     {
-        std::vector<Task> filtered;
-        for (const Task &task : tasks)
+        TaskView filtered;
+        for (const Task *task : tasks)
         {
-            if (task.isDueToday())
+            if (task->isDueToday(context.today))
             {
                 filtered.push_back(task);
             }
@@ -114,151 +160,723 @@ namespace FilterUtils
         return filtered;
     }
 
-    std::vector<Task> filterByCriteria(const std::vector<Task> &tasks,
-                                       const std::string &keyword,
-                                       const std::string &priority,
-                                       const std::string &status,
-                                       const std::string &due_date,
-                                       bool overdue_only,
-                                       bool due_today_only)
+    bool TaskPredicate::matches(const Task &task) const
     {
-        std::vector<Task> result = tasks;
+        if (!matchesFields(task.getStatusCode(), task.getPriorityCode(), task.getDueDay()))
+            return false;
+        if (!keyword_lower.empty() && !task.matchesLowercaseKeyword(keyword_lower))
+            return false;
+        return true;
+    }
+
+    bool TaskPredicate::matchesFields(TaskStatus task_status, TaskPriority task_priority, int32_t task_due_day) const
+    {
+        if (match_none)
+            return false;
+        if (check_status && task_status != status)
+            return false;
+        if (check_priority && task_priority != priority)
+            return false;
+        if (check_due_day && task_due_day != due_day)
+            return false;
+        if (overdue_only && (task_due_day == DateUtils::NO_DATE || task_due_day >= today))
+            return false;
+        if (due_today_only && task_due_day != today)
+            return false;
+        return true;
+    }
+
+    TaskPredicate compileCriteria(const std::string &keyword,
+                                  const std::string &priority,
+                                  const std::string &status,
+                                  const std::string &due_date,
+                                  bool overdue_only,
+                                  bool due_today_only)
+    {
+        return compileCriteria(QueryContext::capture(), keyword, priority, status, due_date,
+                               overdue_only, due_today_only);
+    }
 
-        // Apply filters in sequence
-        if (!keyword.empty())
+    TaskPredicate compileCriteria(const QueryContext &context,
+                                  const std::string &keyword,
+                                  const std::string &priority,
+                                  const std::string &status,
+                                  const std::string &due_date,
+                                  bool overdue_only,
+                                  bool due_today_only)
+    {
+        TaskPredicate predicate;
+
+        if (!status.empty())
         {
-            result = filterByKeyword(result, keyword);
+            predicate.check_status = true;
+            predicate.match_none |= !Task::parseStatus(status, predicate.status);
         }
 
         if (!priority.empty())
         {
-            result = filterByPriority(result, priority);
+            predicate.check_priority = true;
+            predicate.match_none |= !Task::parsePriority(priority, predicate.priority);
         }
 
-        if (!status.empty())
+        if (!due_date.empty())
         {
-            result = filterByStatus(result, status);
+            predicate.check_due_day = true;
+            predicate.due_day = DateUtils::toDayNumber(due_date);
+            predicate.match_none |= predicate.due_day == DateUtils::NO_DATE;
         }
 
-        if (!due_date.empty())
+        predicate.overdue_only = overdue_only;
+        predicate.due_today_only = due_today_only;
+        predicate.today = context.today;
+
+        predicate.keyword_lower = keyword;
+        std::transform(predicate.keyword_lower.begin(), predicate.keyword_lower.end(),
+                       predicate.keyword_lower.begin(),
+                       [](unsigned char c)
+                       { return static_cast<char>(std::tolower(c)); });
+
+        return predicate;
+    }
+
+    TaskView filterByCriteria(const TaskView &tasks, const TaskPredicate &predicate)
+    {
+        TaskView result;
+        if (predicate.match_none)
+            return result;
+
+        for (const Task *task : tasks)
         {
-            result = filterByDueDate(result, due_date);
+            if (predicate.matches(*task))
+            {
+                result.push_back(task);
+            }
         }
+        return result;
+    }
+
+    TaskView filterByCriteria(const TaskView &tasks,
+                              const std::string &keyword,
+                              const std::string &priority,
+                              const std::string &status,
+                              const std::string &due_date,
+                              bool overdue_only,
+                              bool due_today_only)
+    {
+        return filterByCriteria(tasks, compileCriteria(keyword, priority, status, due_date,
+                                                       overdue_only, due_today_only));
+    }
 
-        if (overdue_only)
+    namespace
+    {
+        // Below this size a comparison sort beats the radix passes' fixed cost
+        const size_t RADIX_SORT_MIN = 256;
+
+        struct KeyedTask
         {
-            result = filterOverdue(result);
+            uint64_t key;
+            const Task *task;
+        };
+
+        // Order-preserving map of a signed 32-bit value onto [0, 2^32)
+        inline uint64_t biased(int32_t value)
+        {
+            return static_cast<uint32_t>(value) ^ 0x80000000u;
         }
 
-        if (due_today_only)
+        // Flips a 32-bit key for descending order
+        inline uint64_t directed(uint64_t key, bool ascending)
         {
-            result = filterDueToday(result);
+            return ascending ? key : 0xFFFFFFFFu - key;
         }
 
-        return result;
+        // Stable LSD radix sort on 8-bit digits. Digits that are the same in
+        // every key are skipped, so a 2-bit priority key costs one pass.
+        void radixSort(std::vector<KeyedTask> &items)
+        {
+            if (items.size() < RADIX_SORT_MIN)
+            {
+                std::stable_sort(items.begin(), items.end(), [](const KeyedTask &a, const KeyedTask &b)
+                                 { return a.key < b.key; });
+                return;
+            }
+
+            uint64_t varying = 0;
+            for (const KeyedTask &item : items)
+            {
+                varying |= item.key ^ items[0].key;
+            }
+
+            std::vector<KeyedTask> buffer(items.size());
+            for (unsigned shift = 0; shift < 64; shift += 8)
+            {
+                if (((varying >> shift) & 0xFF) == 0)
+                    continue;
+
+                size_t offsets[256] = {};
+                for (const KeyedTask &item : items)
+                {
+                    offsets[(item.key >> shift) & 0xFF]++;
+                }
+                size_t total = 0;
+                for (size_t &offset : offsets)
+                {
+                    size_t count = offset;
+                    offset = total;
+                    total += count;
+                }
+                for (const KeyedTask &item : items)
+                {
+                    buffer[offsets[(item.key >> shift) & 0xFF]++] = item;
+                }
+                items.swap(buffer);
+            }
+        }
+
+        // Extracts one packed key per task, sorts the keys and permutes the view.
+        // Ties keep their input order.
+        template <typename KeyFn>
+        TaskView sortByKey(TaskView tasks, KeyFn key)
+        {
+            std::vector<KeyedTask> keyed;
+            keyed.reserve(tasks.size());
+            for (const Task *task : tasks)
+            {
+                keyed.push_back({key(*task), task});
+            }
+
+            radixSort(keyed);
+
+            for (size_t i = 0; i < keyed.size(); ++i)
+            {
+                tasks[i] = keyed[i].task;
+            }
+            return tasks;
+        }
     }
 
-    std::vector<Task> sortByPriority(std::vector<Task> tasks, bool ascending)
+    TaskView sortByPriority(TaskView tasks, bool ascending)
     {
-        std::sort(tasks.begin(), tasks.end(), [ascending](const Task &a, const Task &b)
-                  {
-        int priorityA = getPriorityValue(a.getPriority());
-        int priorityB = getPriorityValue(b.getPriority());
-        return ascending ? priorityA < priorityB : priorityA > priorityB; });
-        return tasks;
+        return sortByKey(std::move(tasks), [ascending](const Task &task)
+                         { return directed(static_cast<uint64_t>(task.getPriorityCode()), ascending); });
     }
 
-    std::vector<Task> sortByDueDate(std::vector<Task> tasks, bool ascending)
+    TaskView sortByDueDate(TaskView tasks, bool ascending)
     {
-        std::sort(tasks.begin(), tasks.end(), [ascending](const Task &a, const Task &b)
-                  {
-        std::string dateA = a.getDueDate();
-        std::string dateB = b.getDueDate();
-        
-        // Handle empty dates (put them at the end)
-        if (dateA.empty() && dateB.empty()) return false;
-        if (dateA.empty()) return false;
-        if (dateB.empty()) return true;
-        
-        if (ascending) {
-            return DateUtils::isDateBefore(dateA, dateB);
-        } else {
-            return DateUtils::isDateBefore(dateB, dateA);
-        } });
-        return tasks;
+        // Tasks without a due date sort last in either direction
+        return sortByKey(std::move(tasks), [ascending](const Task &task)
+                         { return task.hasDueDate() ? directed(biased(task.getDueDay()), ascending) : uint64_t(1) << 32; });
     }
 
-    std::vector<Task> sortByStatus(std::vector<Task> tasks, bool ascending)
+    TaskView sortByStatus(TaskView tasks, bool ascending)
     {
-        std::sort(tasks.begin(), tasks.end(), [ascending](const Task &a, const Task &b)
-                  {
-        int statusA = getStatusValue(a.getStatus());
-        int statusB = getStatusValue(b.getStatus());
-        return ascending ? statusA < statusB : statusA > statusB; });
-        return tasks;
+        return sortByKey(std::move(tasks), [ascending](const Task &task)
+                         { return directed(static_cast<uint64_t>(task.getStatusCode()), ascending); });
     }
 
-    std::vector<Task> sortById(std::vector<Task> tasks, bool ascending)
+    TaskView sortById(TaskView tasks, bool ascending)
     {
-        std::sort(tasks.begin(), tasks.end(), [ascending](const Task &a, const Task &b)
-                  { return ascending ? a.getId() < b.getId() : a.getId() > b.getId(); });
-        return tasks;
+        return sortByKey(std::move(tasks), [ascending](const Task &task)
+                         { return directed(biased(task.getId()), ascending); });
     }
 
-    std::vector<Task> sortByCreatedDate(std::vector<Task> tasks, bool ascending)
+    TaskView sortByCreatedDate(TaskView tasks, bool ascending)
     {
-        std::sort(tasks.begin(), tasks.end(), [ascending](const Task &a, const Task &b)
-                  {
-        if (ascending) {
-            return DateUtils::isDateBefore(a.getCreatedDate(), b.getCreatedDate());
-        } else {
-            return DateUtils::isDateBefore(b.getCreatedDate(), a.getCreatedDate());
-        } });
-        return tasks;
+        return sortByKey(std::move(tasks), [ascending](const Task &task)
+                         { return directed(biased(task.getCreatedDay()), ascending); });
     }
 
-    std::vector<Task> filterAndSort(const std::vector<Task> &tasks,
-                                    const std::string &sort_by,
-                                    bool ascending,
-                                    const std::string &keyword,
-                                    const std::string &priority,
-                                    const std::string &status,
-                                    const std::string &due_date,
-                                    bool overdue_only,
-                                    bool due_today_only)
+    bool parseSortField(const std::string &name, SortField &field)
     {
-        // First apply filters
-        std::vector<Task> result = filterByCriteria(tasks, keyword, priority, status,
-                                                    due_date, overdue_only, due_today_only);
+        if (name == "priority")
+            field = SortField::Priority;
+        else if (name == "due_date" || name == "due")
+            field = SortField::DueDate;
+        else if (name == "status")
+            field = SortField::Status;
+        else if (name == "id")
+            field = SortField::Id;
+        else if (name == "created_date" || name == "created")
+            field = SortField::CreatedDate;
+        else
+            return false;
+        return true;
+    }
 
-        // Then apply sorting
-        if (!sort_by.empty())
+    bool parseSortSpec(const std::string &spec, bool default_ascending, std::vector<SortKey> &keys)
+    {
+        keys.clear();
+        if (spec.empty())
+            return false;
+
+        size_t start = 0;
+        while (start <= spec.size())
+        {
+            size_t end = spec.find(',', start);
+            if (end == std::string::npos)
+                end = spec.size();
+
+            std::string item = spec.substr(start, end - start);
+            SortKey key{SortField::Id, default_ascending};
+
+            size_t colon = item.find(':');
+            if (colon != std::string::npos)
+            {
+                std::string direction = item.substr(colon + 1);
+                if (direction == "asc" || direction == "ascending")
+                    key.ascending = true;
+                else if (direction == "desc" || direction == "descending")
+                    key.ascending = false;
+                else
+                    return false;
+                item.resize(colon);
+            }
+
+            if (!parseSortField(item, key.field))
+                return false;
+            keys.push_back(key);
+            start = end + 1;
+        }
+
+        bool hasId = std::any_of(keys.begin(), keys.end(), [](const SortKey &key)
+                                 { return key.field == SortField::Id; });
+        if (!hasId)
+        {
+            keys.push_back({SortField::Id, true});
+        }
+        return true;
+    }
+
+    namespace
+    {
+        // Ascending-order value of one field. Undated due dates are reported
+        // through `dated` and always sort after every date.
+        inline uint64_t fieldValue(const Task &task, SortField field, bool &dated)
+        {
+            dated = true;
+            switch (field)
+            {
+            case SortField::Priority:
+                return static_cast<uint64_t>(task.getPriorityCode());
+            case SortField::Status:
+                return static_cast<uint64_t>(task.getStatusCode());
+            case SortField::Id:
+                return biased(task.getId());
+            case SortField::CreatedDate:
+                return biased(task.getCreatedDay());
+            case SortField::DueDate:
+                dated = task.hasDueDate();
+                return dated ? biased(task.getDueDay()) : 0;
+            }
+            return 0;
+        }
+
+        inline unsigned bitWidth(uint64_t value)
+        {
+            return value == 0 ? 0 : 64 - static_cast<unsigned>(__builtin_clzll(value));
+        }
+
+        // How one key is packed: its value range over the input and the bits that takes
+        struct KeyLayout
+        {
+            SortKey key;
+            uint64_t min = UINT64_MAX;
+            uint64_t max = 0;
+            bool anyUndated = false;
+            unsigned width = 0;
+
+            uint64_t component(const Task &task) const
+            {
+                bool dated;
+                uint64_t value = fieldValue(task, key.field, dated);
+                if (!dated)
+                    return max - min + 1;
+                return key.ascending ? value - min : max - value;
+            }
+        };
+    }
+
+    namespace
+    {
+        // Sizes each key from the values actually present, so typical specs
+        // (enums, a few years of days, IDs) fit one 64-bit key together.
+        // Returns false if they do not.
+        bool layoutKeys(const TaskView &tasks, const std::vector<SortKey> &keys, std::vector<KeyLayout> &layouts)
+        {
+            layouts.clear();
+            for (const SortKey &key : keys)
+            {
+                KeyLayout layout;
+                layout.key = key;
+                layouts.push_back(layout);
+            }
+            for (const Task *task : tasks)
+            {
+                for (KeyLayout &layout : layouts)
+                {
+                    bool dated;
+                    uint64_t value = fieldValue(*task, layout.key.field, dated);
+                    if (!dated)
+                    {
+                        layout.anyUndated = true;
+                        continue;
+                    }
+                    layout.min = std::min(layout.min, value);
+                    layout.max = std::max(layout.max, value);
+                }
+            }
+
+            unsigned totalWidth = 0;
+            for (KeyLayout &layout : layouts)
+            {
+                if (layout.min > layout.max)
+                {
+                    layout.min = layout.max = 0; // Every value undated
+                }
+                layout.width = bitWidth(layout.max - layout.min + (layout.anyUndated ? 1 : 0));
+                totalWidth += layout.width;
+            }
+            return totalWidth <= 64;
+        }
+
+        inline uint64_t packedKey(const Task &task, const std::vector<KeyLayout> &layouts)
         {
-            if (sort_by == "priority")
+            uint64_t packed = 0;
+            for (const KeyLayout &layout : layouts)
             {
-                result = sortByPriority(result, ascending);
+                packed = layout.width == 0 ? packed : (packed << layout.width) | layout.component(task);
             }
-            else if (sort_by == "due_date" || sort_by == "due")
+            return packed;
+        }
+
+        // Equal packed keys (only possible without an ID key) fall back to ID order
+        inline bool keyedBefore(const KeyedTask &a, const KeyedTask &b)
+        {
+            return a.key != b.key ? a.key < b.key : a.task->getId() < b.task->getId();
+        }
+
+        // Sort-key value of one field as written in a cursor: "-" for no due date
+        void appendCursorValue(std::string &cursor, const Task &task, SortField field)
+        {
+            switch (field)
             {
-                result = sortByDueDate(result, ascending);
+            case SortField::Priority:
+                cursor += std::to_string(static_cast<int>(task.getPriorityCode()));
+                break;
+            case SortField::Status:
+                cursor += std::to_string(static_cast<int>(task.getStatusCode()));
+                break;
+            case SortField::Id:
+                cursor += std::to_string(task.getId());
+                break;
+            case SortField::CreatedDate:
+                cursor += std::to_string(task.getCreatedDay());
+                break;
+            case SortField::DueDate:
+                cursor += task.hasDueDate() ? std::to_string(task.getDueDay()) : "-";
+                break;
             }
-            else if (sort_by == "status")
+        }
+
+        struct CursorValue
+        {
+            uint64_t value;
+            bool dated;
+        };
+
+        bool parseCursor(const std::string &cursor, const std::vector<SortKey> &keys, std::vector<CursorValue> &values)
+        {
+            values.clear();
+            size_t start = 0;
+            for (size_t i = 0; i < keys.size(); ++i)
             {
-                result = sortByStatus(result, ascending);
+                size_t end = cursor.find('.', start);
+                if ((end == std::string::npos) != (i + 1 == keys.size()))
+                    return false;
+                if (end == std::string::npos)
+                    end = cursor.size();
+
+                std::string_view item(cursor.data() + start, end - start);
+                start = end + 1;
+                if (item == "-" && keys[i].field == SortField::DueDate)
+                {
+                    values.push_back({0, false});
+                    continue;
+                }
+
+                int64_t number = 0;
+                auto [ptr, ec] = std::from_chars(item.data(), item.data() + item.size(), number);
+                if (ec != std::errc() || ptr != item.data() + item.size() ||
+                    number < INT32_MIN || number > INT32_MAX)
+                    return false;
+
+                SortField field = keys[i].field;
+                bool isCode = field == SortField::Priority || field == SortField::Status;
+                if (isCode && (number < 0 || number > 2))
+                    return false;
+                values.push_back({isCode ? static_cast<uint64_t>(number) : biased(static_cast<int32_t>(number)), true});
             }
-            else if (sort_by == "id")
+            return true;
+        }
+
+        // True if the task comes strictly after the cursor row in key order
+        bool isAfterCursor(const Task &task, const std::vector<SortKey> &keys, const std::vector<CursorValue> &cursor)
+        {
+            for (size_t i = 0; i < keys.size(); ++i)
             {
-                result = sortById(result, ascending);
+                bool dated;
+                uint64_t value = fieldValue(task, keys[i].field, dated);
+                if (dated != cursor[i].dated)
+                    return !dated; // Undated sorts last in either direction
+                if (!dated || value == cursor[i].value)
+                    continue;
+                return keys[i].ascending ? value > cursor[i].value : value < cursor[i].value;
             }
-            else if (sort_by == "created_date" || sort_by == "created")
+            return false;
+        }
+    }
+
+    TaskView sortByKeys(TaskView tasks, const std::vector<SortKey> &keys)
+    {
+        if (keys.empty() || tasks.size() < 2)
+            return tasks;
+
+        std::vector<KeyLayout> layouts;
+        if (layoutKeys(tasks, keys, layouts))
+        {
+            return sortByKey(std::move(tasks), [&layouts](const Task &task)
+                             { return packedKey(task, layouts); });
+        }
+
+        // Too wide for one key: stable passes from the least significant key up
+        for (auto it = layouts.rbegin(); it != layouts.rend(); ++it)
+        {
+            const KeyLayout &layout = *it;
+            tasks = sortByKey(std::move(tasks), [&layout](const Task &task)
+                              { return layout.component(task); });
+        }
+        return tasks;
+    }
+
+    TaskView sortTopK(TaskView tasks, const std::vector<SortKey> &keys, size_t k)
+    {
+        // A heap only pays off while k is a small fraction of the input
+        std::vector<KeyLayout> layouts;
+        if (k > tasks.size() / 8 || keys.empty() || !layoutKeys(tasks, keys, layouts))
+        {
+            tasks = sortByKeys(std::move(tasks), keys);
+            tasks.resize(std::min(k, tasks.size()));
+            return tasks;
+        }
+
+        // Max-heap of the best k so far; most tasks are rejected by one compare
+        std::vector<KeyedTask> heap;
+        heap.reserve(k + 1);
+        for (const Task *task : tasks)
+        {
+            KeyedTask item{packedKey(*task, layouts), task};
+            if (heap.size() < k)
             {
-                result = sortByCreatedDate(result, ascending);
+                heap.push_back(item);
+                std::push_heap(heap.begin(), heap.end(), keyedBefore);
+            }
+            else if (k > 0 && keyedBefore(item, heap.front()))
+            {
+                std::pop_heap(heap.begin(), heap.end(), keyedBefore);
+                heap.back() = item;
+                std::push_heap(heap.begin(), heap.end(), keyedBefore);
             }
         }
+        std::sort_heap(heap.begin(), heap.end(), keyedBefore);
 
+        tasks.resize(heap.size());
+        for (size_t i = 0; i < heap.size(); ++i)
+        {
+            tasks[i] = heap[i].task;
+        }
+        return tasks;
+    }
+
+    std::string makeCursor(const Task &task, const std::vector<SortKey> &keys)
+    {
+        std::string cursor;
+        for (const SortKey &key : keys)
+        {
+            if (!cursor.empty())
+                cursor += '.';
+            appendCursorValue(cursor, task, key.field);
+        }
+        return cursor;
+    }
+
+    TaskPage pageOf(const TaskView &ordered, const std::vector<SortKey> &keys, const PageRequest &page)
+    {
+        TaskPage result;
+        size_t begin = std::min(page.offset, ordered.size());
+        size_t end = page.limit == 0 ? ordered.size() : std::min(ordered.size(), begin + page.limit);
+        result.tasks.assign(ordered.begin() + static_cast<std::ptrdiff_t>(begin),
+                            ordered.begin() + static_cast<std::ptrdiff_t>(end));
+        result.has_more = end < ordered.size();
+        if (result.has_more && !result.tasks.empty())
+        {
+            result.next_cursor = makeCursor(*result.tasks.back(), keys);
+        }
         return result;
     }
 
+    bool paginate(TaskView tasks, const std::vector<SortKey> &keys, const PageRequest &page, TaskPage &out)
+    {
+        std::vector<SortKey> order = keys;
+        if (order.empty())
+        {
+            order.push_back({SortField::Id, true});
+        }
+
+        if (!page.after.empty())
+        {
+            std::vector<CursorValue> cursor;
+            if (!parseCursor(page.after, order, cursor))
+                return false;
+            tasks.erase(std::remove_if(tasks.begin(), tasks.end(),
+                                       [&order, &cursor](const Task *task)
+                                       { return !isAfterCursor(*task, order, cursor); }),
+                        tasks.end());
+        }
+
+        // One row past the page tells whether another page follows
+        if (page.limit == 0)
+        {
+            tasks = sortByKeys(std::move(tasks), order);
+        }
+        else
+        {
+            size_t needed = page.offset + page.limit + 1;
+            tasks = sortTopK(std::move(tasks), order, needed < page.limit ? tasks.size() : needed);
+        }
+        out = pageOf(tasks, order, page);
+        return true;
+    }
+
+    TaskView sortBy(TaskView tasks, const std::string &sort_by, bool ascending)
+    {
+        std::vector<SortKey> keys;
+        if (!parseSortSpec(sort_by, ascending, keys))
+        {
+            return tasks;
+        }
+        return sortByKeys(std::move(tasks), keys);
+    }
+
+    TaskView filterAndSort(const TaskView &tasks,
+                           const std::string &sort_by,
+                           bool ascending,
+                           const std::string &keyword,
+                           const std::string &priority,
+                           const std::string &status,
+                           const std::string &due_date,
+                           bool overdue_only,
+                           bool due_today_only)
+    {
+        // First apply filters
+        TaskView result = filterByCriteria(tasks, keyword, priority, status,
+                                           due_date, overdue_only, due_today_only);
+
+        // Then apply sorting
+        if (!sort_by.empty())
+        {
+            result = sortBy(std::move(result), sort_by, ascending);
+        }
+
+        return result;
+    }
+
+    std::vector<Task> filterByKeyword(const std::vector<Task> &tasks, const std::string &keyword)
+    {
+        return materialize(filterByKeyword(viewOf(tasks), keyword));
+    }
+
+    std::vector<Task> filterByPriority(const std::vector<Task> &tasks, const std::string &priority)
+    {
+        return materialize(filterByPriority(viewOf(tasks), priority));
+    }
+
+    std::vector<Task> filterByStatus(const std::vector<Task> &tasks, const std::string &status)
+    {
+        return materialize(filterByStatus(viewOf(tasks), status));
+    }
+
+    std::vector<Task> filterByDateRange(const std::vector<Task> &tasks,
+                                        const std::string &start_date, const std::string &end_date)
+    {
+        return materialize(filterByDateRange(viewOf(tasks), start_date, end_date));
+    }
+
+    std::vector<Task> filterByDueDate(const std::vector<Task> &tasks, const std::string &due_date)
+    {
+        return materialize(filterByDueDate(viewOf(tasks), due_date));
+    }
+
+    std::vector<Task> filterOverdue(const std::vector<Task> &tasks)
+    {
+        return materialize(filterOverdue(viewOf(tasks), QueryContext::capture()));
+    }
+
+    std::vector<Task> filterDueToday(const std::vector<Task> &tasks)
+    {
+        return materialize(filterDueToday(viewOf(tasks), QueryContext::capture()));
+    }
+
+    std::vector<Task> filterByCriteria(const std::vector<Task> &tasks,
+                                       const std::string &keyword,
+                                       const std::string &priority,
+                                       const std::string &status,
+                                       const std::string &due_date,
+                                       bool overdue_only,
+                                       bool due_today_only)
+    {
+        return materialize(filterByCriteria(viewOf(tasks), keyword, priority, status,
+                                            due_date, overdue_only, due_today_only));
+    }
+
+    std::vector<Task> sortByPriority(std::vector<Task> tasks, bool ascending)
+    {
+        return materialize(sortByPriority(viewOf(tasks), ascending));
+    }
+
+    std::vector<Task> sortByDueDate(std::vector<Task> tasks, bool ascending)
+    {
+        return materialize(sortByDueDate(viewOf(tasks), ascending));
+    }
+
+    std::vector<Task> sortByStatus(std::vector<Task> tasks, bool ascending)
+    {
+        return materialize(sortByStatus(viewOf(tasks), ascending));
+    }
+
+    std::vector<Task> sortById(std::vector<Task> tasks, bool ascending)
+    {
+        return materialize(sortById(viewOf(tasks), ascending));
+    }
+
+    std::vector<Task> sortByCreatedDate(std::vector<Task> tasks, bool ascending)
+    {
+        return materialize(sortByCreatedDate(viewOf(tasks), ascending));
+    }
+
+    std::vector<Task> filterAndSort(const std::vector<Task> &tasks,
+                                    const std::string &sort_by,
+                                    bool ascending,
+                                    const std::string &keyword,
+                                    const std::string &priority,
+                                    const std::string &status,
+                                    const std::string &due_date,
+                                    bool overdue_only,
+                                    bool due_today_only)
+    {
+        return materialize(filterAndSort(viewOf(tasks), sort_by, ascending, keyword, priority,
+                                         status, due_date, overdue_only, due_today_only));
+    }
+
     int getPriorityValue(const std::string &priority)
     {
         if (priority == "high")
@@ -283,8 +901,14 @@ namespace FilterUtils
 
     bool isValidSortField(const std::string &field)
     {
-        return (field == "priority" || field == "due_date" || field == "due" ||
-                field == "status" || field == "id" || field == "created_date" || field == "created");
+        SortField parsed;
+        return parseSortField(field, parsed);
+    }
+
+    bool isValidSortSpec(const std::string &spec)
+    {
+        std::vector<SortKey> keys;
+        return parseSortSpec(spec, true, keys);
     }
 
-}
\ No newline at end of file
+}
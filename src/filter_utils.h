@@ -5,10 +5,137 @@
 #include <string>
 #include <functional>
 #include "task.h"
+#include "query_context.h"
 
 namespace FilterUtils
 {
-    // Filtering functions
+    // Filter criteria compiled once: strings are parsed up front and checks run
+    // cheapest first (enum compares, then day compares, then keyword search).
+    struct TaskPredicate
+    {
+        bool match_none = false; // An unparseable status/priority/date matches nothing
+        bool check_status = false;
+        bool check_priority = false;
+        bool check_due_day = false;
+        bool overdue_only = false;
+        bool due_today_only = false;
+        TaskStatus status = TaskStatus::Pending;
+        TaskPriority priority = TaskPriority::Medium;
+        int32_t due_day = 0;
+        int32_t today = 0;
+        std::string keyword_lower;
+
+        bool matches(const Task &task) const;
+        // Everything but the keyword, from column values
+        bool matchesFields(TaskStatus task_status, TaskPriority task_priority, int32_t task_due_day) const;
+    };
+
+    TaskPredicate compileCriteria(const QueryContext &context,
+                                  const std::string &keyword = "",
+                                  const std::string &priority = "",
+                                  const std::string &status = "",
+                                  const std::string &due_date = "",
+                                  bool overdue_only = false,
+                                  bool due_today_only = false);
+    TaskPredicate compileCriteria(const std::string &keyword = "",
+                                  const std::string &priority = "",
+                                  const std::string &status = "",
+                                  const std::string &due_date = "",
+                                  bool overdue_only = false,
+                                  bool due_today_only = false);
+
+    // Views
+    TaskView viewOf(const std::vector<Task> &tasks);
+    std::vector<Task> materialize(const TaskView &view);
+
+    // Filtering functions (zero-copy: return pointers into the input)
+    TaskView filterByKeyword(const TaskView &tasks, const std::string &keyword);
+    TaskView filterByPriority(const TaskView &tasks, const std::string &priority);
+    TaskView filterByStatus(const TaskView &tasks, const std::string &status);
+    TaskView filterByDateRange(const TaskView &tasks,
+                               const std::string &start_date, const std::string &end_date);
+    TaskView filterByDueDate(const TaskView &tasks, const std::string &due_date);
+    TaskView filterOverdue(const TaskView &tasks, const QueryContext &context);
+    TaskView filterDueToday(const TaskView &tasks, const QueryContext &context);
+
+    // Single pass over the input with a compiled predicate
+    TaskView filterByCriteria(const TaskView &tasks, const TaskPredicate &predicate);
+    TaskView filterByCriteria(const TaskView &tasks,
+                              const std::string &keyword = "",
+                              const std::string &priority = "",
+                              const std::string &status = "",
+                              const std::string &due_date = "",
+                              bool overdue_only = false,
+                              bool due_today_only = false);
+
+    // Composite sort keys, e.g. "priority:desc,due:asc,id". Keys without a
+    // direction use the default; an ascending ID key is appended when absent
+    // so ties always break the same way.
+    enum class SortField : uint8_t
+    {
+        Priority,
+        DueDate,
+        Status,
+        Id,
+        CreatedDate
+    };
+
+    struct SortKey
+    {
+        SortField field;
+        bool ascending;
+    };
+
+    bool parseSortField(const std::string &name, SortField &field);
+    bool parseSortSpec(const std::string &spec, bool default_ascending, std::vector<SortKey> &keys);
+
+    // Sorting functions (reorder pointers only)
+    TaskView sortByKeys(TaskView tasks, const std::vector<SortKey> &keys);
+    TaskView sortByPriority(TaskView tasks, bool ascending = false);
+    TaskView sortByDueDate(TaskView tasks, bool ascending = true);
+    TaskView sortByStatus(TaskView tasks, bool ascending = true);
+    TaskView sortById(TaskView tasks, bool ascending = true);
+    TaskView sortByCreatedDate(TaskView tasks, bool ascending = true);
+    TaskView sortBy(TaskView tasks, const std::string &sort_by, bool ascending = true);
+
+    // The first k tasks of sortByKeys' order, via a bounded heap when k is small
+    TaskView sortTopK(TaskView tasks, const std::vector<SortKey> &keys, size_t k);
+
+    // Pagination. A cursor holds the sort-key values of the last row shown
+    // ("2.20300.17"), so the next page starts strictly after that row even if
+    // tasks were added or removed in between.
+    struct PageRequest
+    {
+        size_t offset = 0;
+        size_t limit = 0;  // 0 = no limit
+        std::string after; // Cursor from a previous page
+    };
+
+    struct TaskPage
+    {
+        TaskView tasks;
+        bool has_more = false;
+        std::string next_cursor; // Set when has_more
+    };
+
+    std::string makeCursor(const Task &task, const std::vector<SortKey> &keys);
+    // Cuts a page out of tasks already in key order (at least offset + limit + 1 of them)
+    TaskPage pageOf(const TaskView &ordered, const std::vector<SortKey> &keys, const PageRequest &page);
+    // Sorts only as far as the page needs; no keys means ID order. Returns false
+    // if the cursor does not match the keys.
+    bool paginate(TaskView tasks, const std::vector<SortKey> &keys, const PageRequest &page, TaskPage &out);
+
+    TaskView filterAndSort(const TaskView &tasks,
+                           const std::string &sort_by = "",
+                           bool ascending = true,
+                           const std::string &keyword = "",
+                           const std::string &priority = "",
+                           const std::string &status = "",
+                           const std::string &due_date = "",
+                           bool overdue_only = false,
+                           bool due_today_only = false);
+
+    // Copying variants of the above
     std::vector<Task> filterByKeyword(const std::vector<Task> &tasks, const std::string &keyword);
     std::vector<Task> filterByPriority(const std::vector<Task> &tasks, const std::string &priority);
     std::vector<Task> filterByStatus(const std::vector<Task> &tasks, const std::string &status);
@@ -49,6 +176,7 @@ namespace FilterUtils
     int getPriorityValue(const std::string &priority);
     int getStatusValue(const std::string &status);
     bool isValidSortField(const std::string &field);
+    bool isValidSortSpec(const std::string &spec);
 }
 
-#endif
\ No newline at end of file
+#endif
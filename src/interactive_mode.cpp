@@ -98,29 +98,31 @@ void InteractiveMode::displayGoodbye()
 
 void InteractiveMode::displayStats()
 {
-    std::vector<Task> allTasks = taskManager.getAllTasks();
-    std::vector<Task> pending = taskManager.getTasksByStatus("pending");
-    std::vector<Task> inProgress = taskManager.getTasksByStatus("in_progress");
-    std::vector<Task> done = taskManager.getTasksByStatus("done");
-    std::vector<Task> overdue = taskManager.getOverdueTasks();
-    std::vector<Task> dueToday = taskManager.getTasksDueToday();
+    // Maintained counters plus two due-index lookups; no task is visited
+    TaskCounts counts = taskManager.countTasks(QueryContext::capture());
+    size_t total = counts.total;
+    size_t pending = counts.byStatus[static_cast<size_t>(TaskStatus::Pending)];
+    size_t inProgress = counts.byStatus[static_cast<size_t>(TaskStatus::InProgress)];
+    size_t done = counts.byStatus[static_cast<size_t>(TaskStatus::Done)];
+    size_t overdue = counts.overdue;
+    size_t dueToday = counts.dueToday;
 
     std::cout << "\n\033[3m\033[1;37mTask Overview\033[0m" << std::endl;
-    std::cout << "\033[2mTotal:\033[0m \033[1m" << allTasks.size() << "\033[0m";
-    std::cout << "\033[2m  |  Pending:\033[0m \033[1;33m" << pending.size() << "\033[0m";
-    std::cout << "\033[2m  |  Active:\033[0m \033[1;34m" << inProgress.size() << "\033[0m";
-    std::cout << "\033[2m  |  Done:\033[0m \033[1;32m" << done.size() << "\033[0m" << std::endl;
+    std::cout << "\033[2mTotal:\033[0m \033[1m" << total << "\033[0m";
+    std::cout << "\033[2m  |  Pending:\033[0m \033[1;33m" << pending << "\033[0m";
+    std::cout << "\033[2m  |  Active:\033[0m \033[1;34m" << inProgress << "\033[0m";
+    std::cout << "\033[2m  |  Done:\033[0m \033[1;32m" << done << "\033[0m" << std::endl;
 
-    if (!overdue.empty() || !dueToday.empty())
+    if (overdue > 0 || dueToday > 0)
     {
         std::cout << "\033[2mAlerts:\033[0m";
-        if (!overdue.empty())
+        if (overdue > 0)
         {
-            std::cout << " \033[1;31m⚠\033[0m \033[2mOverdue:\033[0m \033[1;31m" << overdue.size() << "\033[0m";
+            std::cout << " \033[1;31m⚠\033[0m \033[2mOverdue:\033[0m \033[1;31m" << overdue << "\033[0m";
         }
-        if (!dueToday.empty())
+        if (dueToday > 0)
         {
-            std::cout << " \033[1;33m⏰\033[0m \033[2mDue today:\033[0m \033[1;33m" << dueToday.size() << "\033[0m";
+            std::cout << " \033[1;33m⏰\033[0m \033[2mDue today:\033[0m \033[1;33m" << dueToday << "\033[0m";
         }
         std::cout << std::endl;
     }
@@ -204,6 +206,7 @@ void InteractiveMode::showHelp()
     std::cout << "\033[1;34mfilter\033[0m \033[2mpriority|status\033[0m \033[2m<value>\033[0m           \033[2mFilter by criteria\033[0m" << std::endl;
     std::cout << "\033[1;34msort\033[0m \033[2mpriority|due_date|status\033[0m [\033[2masc|desc\033[0m]   \033[2mSort tasks\033[0m" << std::endl;
     std::cout << "\033[1;34mdue\033[0m \033[2mtoday|<date>\033[0m  |  \033[1;34moverdue\033[0m  |  \033[1;34mtoday\033[0m      \033[2mDate views\033[0m" << std::endl;
+    std::cout << "\033[1;34mcount\033[0m [\033[2m\"keyword\"\033[0m] [\033[2mfilters\033[0m]                \033[2mCount matching tasks\033[0m" << std::endl;
 
     std::cout << "\n\033[3m\033[1;37mSession Controls\033[0m" << std::endl;
     std::cout << "\033[1;35mhelp\033[0m, \033[1;35mh\033[0m        \033[2mShow this help\033[0m" << std::endl;
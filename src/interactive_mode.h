@@ -31,6 +31,8 @@ public:
     // Input processing
     std::vector<std::string> parseInput(const std::string &input);
     void processCommand(const std::vector<std::string> &args);
+    // Splits on spaces; double quotes group words (shared with batch mode)
+    static std::vector<std::string> tokenize(const std::string &input);
 
     // Session management
     void autoSave();
@@ -40,7 +42,6 @@ public:
 private:
     // Helper methods
     std::string trim(const std::string &str);
-    std::vector<std::string> tokenize(const std::string &input);
     bool isExitCommand(const std::string &command);
     void handleSpecialCommands(const std::vector<std::string> &args);
 };
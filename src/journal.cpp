@@ -0,0 +1,198 @@
+#include "journal.h"
+#include "json_parser.h"
+#include "durable_file.h"
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+
+Journal::Journal(const std::string &path) : path(path), bytes(0), deferred(false), tornTail(false) {}
+
+bool Journal::appendLine(const std::string &line)
+{
+    if (deferred)
+    {
+        pending += line;
+        bytes += line.size();
+        return true;
+    }
+
+    // Records left by a failed sync go first, keeping the log in order
+    if (!writeDurably(pending.empty() ? line : pending + line))
+        return false;
+    pending.clear();
+    bytes += line.size();
+    return true;
+}
+
+bool Journal::writeDurably(const std::string &data)
+{
+    // A journal created here is only durable once its directory entry is
+    bool created = false;
+    int fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (fd < 0 && errno == ENOENT)
+    {
+        fd = ::open(path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        created = fd >= 0;
+    }
+    if (fd < 0)
+    {
+        std::cerr << "Error: Cannot open journal " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    // A torn tail that could not be cut off is closed with a newline instead;
+    // replay then skips it as a malformed record
+    off_t start = ::lseek(fd, 0, SEEK_END);
+    bool durable = (!tornTail || DurableFile::writeAll(fd, "\n")) && DurableFile::writeAll(fd, data) &&
+                   ::fsync(fd) == 0;
+    if (!durable)
+    {
+        std::cerr << "Error: Cannot write to journal " << path << ": " << std::strerror(errno) << std::endl;
+        // Drop a torn tail so the next record does not run into it
+        if (start >= 0)
+            (void)::ftruncate(fd, start);
+    }
+    durable = ::close(fd) == 0 && durable;
+    if (durable)
+        tornTail = false;
+    if (durable && created)
+        durable = DurableFile::syncDirectory(path);
+    return durable;
+}
+
+bool Journal::setDeferredSync(bool defer)
+{
+    bool synced = defer || sync();
+    deferred = defer;
+    return synced;
+}
+
+bool Journal::sync()
+{
+    if (pending.empty())
+        return true;
+    if (!writeDurably(pending))
+        return false; // Kept for the next attempt
+    pending.clear();
+    return true;
+}
+
+bool Journal::hasPending() const
+{
+    return !pending.empty();
+}
+
+bool Journal::appendPut(const Task &task)
+{
+    return appendLine("put " + JSONParser::taskToJSONObject(task) + "\n");
+}
+
+bool Journal::appendDelete(int id)
+{
+    return appendLine("del " + std::to_string(id) + "\n");
+}
+
+std::vector<JournalRecord> Journal::readAll()
+{
+    std::vector<JournalRecord> records;
+
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        bytes = 0;
+        return records;
+    }
+
+    std::string content((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+    file.close();
+    bytes = content.size();
+
+    size_t pos = 0;
+    while (pos < content.length())
+    {
+        size_t lineEnd = content.find('\n', pos);
+        if (lineEnd == std::string::npos)
+        {
+            // Torn write from an interrupted append; the mutation never completed.
+            // Cut it off so the next append does not run into it.
+            if (dropTail(pos))
+                bytes = pos;
+            else
+                tornTail = true;
+            break;
+        }
+
+        std::string line = content.substr(pos, lineEnd - pos);
+        pos = lineEnd + 1;
+
+        if (line.compare(0, 4, "put ") == 0)
+        {
+            JournalRecord record{JournalRecord::Op::Put, 0, Task()};
+            if (JSONParser::parseTaskObject(line.substr(4), record.task))
+            {
+                record.id = record.task.getId();
+                records.push_back(record);
+            }
+            else
+            {
+                std::cerr << "Warning: Skipping malformed journal record." << std::endl;
+            }
+        }
+        else if (line.compare(0, 4, "del ") == 0)
+        {
+            try
+            {
+                records.push_back({JournalRecord::Op::Delete, std::stoi(line.substr(4)), Task()});
+            }
+            catch (const std::exception &)
+            {
+                std::cerr << "Warning: Skipping malformed journal record." << std::endl;
+            }
+        }
+        else
+        {
+            std::cerr << "Warning: Skipping malformed journal record." << std::endl;
+        }
+    }
+
+    return records;
+}
+
+bool Journal::dropTail(size_t length)
+{
+    int fd = ::open(path.c_str(), O_WRONLY | O_CLOEXEC);
+    bool dropped = fd >= 0 && ::ftruncate(fd, static_cast<off_t>(length)) == 0 && ::fsync(fd) == 0;
+    if (fd >= 0)
+        dropped = ::close(fd) == 0 && dropped;
+    if (!dropped)
+        std::cerr << "Error: Cannot drop the torn tail of journal " << path << ": " << std::strerror(errno) << std::endl;
+    return dropped;
+}
+
+bool Journal::truncate()
+{
+    // Only called once a durable snapshot holds every record, pending ones included
+    pending.clear();
+    bytes = 0;
+    tornTail = false;
+
+    int fd = ::open(path.c_str(), O_WRONLY | O_TRUNC | O_CLOEXEC);
+    if (fd < 0)
+        return errno == ENOENT;
+    bool synced = ::fsync(fd) == 0;
+    return ::close(fd) == 0 && synced;
+}
+
+size_t Journal::size() const
+{
+    return bytes;
+}
+
+const std::string &Journal::getPath() const
+{
+    return path;
+}
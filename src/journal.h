@@ -0,0 +1,63 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <string>
+#include <vector>
+#include "task.h"
+
+// One replayable mutation. Puts carry the full task state so replaying a
+// record twice (e.g. after a crash between checkpoint and truncate) is harmless.
+struct JournalRecord
+{
+    enum class Op
+    {
+        Put,
+        Delete
+    };
+
+    Op op;
+    int id;
+    Task task;
+};
+
+// Append-only write-ahead log that lives next to the JSON snapshot.
+// Each mutation is one line: "put {...}" or "del <id>".
+class Journal
+{
+private:
+    std::string path;
+    size_t bytes;
+    bool deferred;
+    std::string pending; // Records appended since the last sync (deferred mode)
+    bool tornTail;       // The file ends in a fragment that could not be cut off
+
+    bool appendLine(const std::string &line);
+    bool writeDurably(const std::string &data);
+    bool dropTail(size_t length); // Cuts the file back to its first length bytes
+
+public:
+    explicit Journal(const std::string &path);
+
+    // Durable appends (written and fsync'ed before returning), unless sync
+    // is deferred
+    bool appendPut(const Task &task);
+    bool appendDelete(int id);
+
+    // Group commit: with sync deferred, appends are buffered and sync()
+    // writes them all with a single fsync
+    bool setDeferredSync(bool defer); // False if turning it off failed to sync
+    bool sync();
+    bool hasPending() const;
+
+    // Reads every complete record. A torn trailing line is cut off the file,
+    // since it was never acknowledged and the next append would run into it.
+    std::vector<JournalRecord> readAll();
+
+    // Empties the log (and drops unsynced records) once a durable snapshot
+    // holds them; false if the emptied file could not be synced
+    bool truncate();
+    size_t size() const;
+    const std::string &getPath() const;
+};
+
+#endif
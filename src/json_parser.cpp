@@ -1,6 +1,8 @@
 #include "json_parser.h"
+#include "date_utils.h"
 #include <sstream>
 #include <iostream>
+#include <limits>
 
 namespace JSONParser
 {
@@ -28,7 +30,18 @@ namespace JSONParser
                 escaped += "\\t";
                 break;
             default:
-                escaped += c;
+                if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    // Remaining control characters must be \u-escaped to stay valid JSON
+                    const char *hex = "0123456789abcdef";
+                    escaped += "\\u00";
+                    escaped += hex[(c >> 4) & 0xF];
+                    escaped += hex[c & 0xF];
+                }
+                else
+                {
+                    escaped += c;
+                }
                 break;
             }
         }
@@ -77,130 +90,469 @@ namespace JSONParser
         return unescaped;
     }
 
-    std::string extractStringField(const std::string &objectStr, const std::string &fieldName)
+    namespace
     {
-        std::string searchStr = "\"" + fieldName + "\":";
-        size_t fieldPos = objectStr.find(searchStr);
-        if (fieldPos == std::string::npos)
-            return "";
-
-        size_t quoteStart = objectStr.find('"', fieldPos + searchStr.length());
-        if (quoteStart == std::string::npos)
-            return "";
+        // Forward-only cursor over the raw buffer. Every byte of the input is
+        // visited once; strings are decoded straight into reusable buffers.
+        struct Cursor
+        {
+            const char *pos;
+            const char *end;
 
-        size_t quoteEnd = objectStr.find('"', quoteStart + 1);
-        if (quoteEnd == std::string::npos)
-            return "";
+            bool atEnd() const { return pos >= end; }
 
-        return unescapeJSON(objectStr.substr(quoteStart + 1, quoteEnd - quoteStart - 1));
-    }
+            void skipWhitespace()
+            {
+                while (pos < end && (*pos == ' ' || *pos == '\n' || *pos == '\r' || *pos == '\t'))
+                {
+                    pos++;
+                }
+            }
 
-    int extractIntField(const std::string &objectStr, const std::string &fieldName)
-    {
-        std::string searchStr = "\"" + fieldName + "\":";
-        size_t fieldPos = objectStr.find(searchStr);
-        if (fieldPos == std::string::npos)
-            return 0;
+            bool consume(char expected)
+            {
+                skipWhitespace();
+                if (pos < end && *pos == expected)
+                {
+                    pos++;
+                    return true;
+                }
+                return false;
+            }
 
-        size_t valueStart = objectStr.find_first_not_of(" \t", fieldPos + searchStr.length());
-        if (valueStart == std::string::npos)
-            return 0;
+            char peek()
+            {
+                skipWhitespace();
+                return pos < end ? *pos : '\0';
+            }
+        };
 
-        size_t valueEnd = objectStr.find_first_of(",}", valueStart);
-        if (valueEnd == std::string::npos)
-            return 0;
+        void appendUTF8(std::string &out, unsigned codepoint)
+        {
+            if (codepoint < 0x80)
+            {
+                out += static_cast<char>(codepoint);
+            }
+            else if (codepoint < 0x800)
+            {
+                out += static_cast<char>(0xC0 | (codepoint >> 6));
+                out += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+            else if (codepoint < 0x10000)
+            {
+                out += static_cast<char>(0xE0 | (codepoint >> 12));
+                out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+            else
+            {
+                out += static_cast<char>(0xF0 | (codepoint >> 18));
+                out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+        }
 
-        try
+        bool parseHex4(Cursor &cur, unsigned &value)
         {
-            return std::stoi(objectStr.substr(valueStart, valueEnd - valueStart));
+            if (cur.end - cur.pos < 4)
+                return false;
+
+            value = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                char c = *cur.pos++;
+                value <<= 4;
+                if (c >= '0' && c <= '9')
+                    value |= static_cast<unsigned>(c - '0');
+                else if (c >= 'a' && c <= 'f')
+                    value |= static_cast<unsigned>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F')
+                    value |= static_cast<unsigned>(c - 'A' + 10);
+                else
+                    return false;
+            }
+            return true;
         }
-        catch (const std::exception &)
+
+        // Expects the cursor on the opening quote; decodes escapes into out
+        bool parseString(Cursor &cur, std::string &out)
         {
-            return 0;
+            out.clear();
+            if (!cur.consume('"'))
+                return false;
+
+            while (cur.pos < cur.end)
+            {
+                // Copy the unescaped run in one go
+                const char *runStart = cur.pos;
+                while (cur.pos < cur.end && *cur.pos != '"' && *cur.pos != '\\')
+                {
+                    cur.pos++;
+                }
+                out.append(runStart, cur.pos);
+
+                if (cur.pos >= cur.end)
+                    return false;
+
+                if (*cur.pos == '"')
+                {
+                    cur.pos++;
+                    return true;
+                }
+
+                // Backslash escape
+                cur.pos++;
+                if (cur.pos >= cur.end)
+                    return false;
+
+                char c = *cur.pos++;
+                switch (c)
+                {
+                case '"':
+                    out += '"';
+                    break;
+                case '\\':
+                    out += '\\';
+                    break;
+                case '/':
+                    out += '/';
+                    break;
+                case 'b':
+                    out += '\b';
+                    break;
+                case 'f':
+                    out += '\f';
+                    break;
+                case 'n':
+                    out += '\n';
+                    break;
+                case 'r':
+                    out += '\r';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                case 'u':
+                {
+                    unsigned codepoint;
+                    if (!parseHex4(cur, codepoint))
+                        return false;
+
+                    // Characters outside the BMP arrive as a \uD8xx\uDCxx surrogate
+                    // pair and become one 4-byte sequence; an unpaired half has no
+                    // UTF-8 encoding and becomes U+FFFD
+                    if (codepoint >= 0xD800 && codepoint <= 0xDBFF && cur.end - cur.pos >= 6 &&
+                        cur.pos[0] == '\\' && cur.pos[1] == 'u')
+                    {
+                        Cursor next{cur.pos + 2, cur.end};
+                        unsigned low;
+                        if (parseHex4(next, low) && low >= 0xDC00 && low <= 0xDFFF)
+                        {
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                            cur.pos = next.pos;
+                        }
+                    }
+                    if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+                        codepoint = 0xFFFD;
+                    appendUTF8(out, codepoint);
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+            return false;
         }
-    }
 
-    std::vector<Task> parseTasksFromJSON(const std::string &jsonContent)
-    {
-        std::vector<Task> tasks;
+        bool parseInt(Cursor &cur, long long &value)
+        {
+            cur.skipWhitespace();
+            bool negative = false;
+            if (cur.pos < cur.end && *cur.pos == '-')
+            {
+                negative = true;
+                cur.pos++;
+            }
 
-        if (jsonContent.empty() || jsonContent == "[]")
+            // Saturates instead of overflowing; IDs that large are rejected anyway
+            const long long LIMIT = std::numeric_limits<long long>::max();
+            const char *digitsStart = cur.pos;
+            value = 0;
+            while (cur.pos < cur.end && *cur.pos >= '0' && *cur.pos <= '9')
+            {
+                int digit = *cur.pos - '0';
+                value = value > (LIMIT - digit) / 10 ? LIMIT : value * 10 + digit;
+                cur.pos++;
+            }
+
+            // Tolerate a fractional/exponent part by skipping it
+            while (cur.pos < cur.end && (*cur.pos == '.' || *cur.pos == 'e' || *cur.pos == 'E' ||
+                                         *cur.pos == '+' || *cur.pos == '-' ||
+                                         (*cur.pos >= '0' && *cur.pos <= '9')))
+            {
+                cur.pos++;
+            }
+
+            if (negative)
+                value = -value;
+            return cur.pos != digitsStart;
+        }
+
+        // Skips any JSON value (used for fields the Task model does not know)
+        bool skipValue(Cursor &cur, std::string &scratch)
         {
-            return tasks;
+            char c = cur.peek();
+            if (c == '"')
+            {
+                return parseString(cur, scratch);
+            }
+            if (c == '{' || c == '[')
+            {
+                char close = (c == '{') ? '}' : ']';
+                cur.pos++;
+                if (cur.consume(close))
+                    return true;
+                do
+                {
+                    if (c == '{')
+                    {
+                        if (!parseString(cur, scratch) || !cur.consume(':'))
+                            return false;
+                    }
+                    if (!skipValue(cur, scratch))
+                        return false;
+                } while (cur.consume(','));
+                return cur.consume(close);
+            }
+
+            // Number, true, false or null
+            const char *start = cur.pos;
+            while (cur.pos < cur.end && *cur.pos != ',' && *cur.pos != '}' && *cur.pos != ']' &&
+                   *cur.pos != ' ' && *cur.pos != '\n' && *cur.pos != '\r' && *cur.pos != '\t')
+            {
+                cur.pos++;
+            }
+            return cur.pos != start;
         }
 
-        size_t pos = 0;
+        // Reusable per-object field buffers so steady-state parsing does not allocate
+        struct TaskFields
+        {
+            long long id = 0;
+            std::string description;
+            std::string status;
+            std::string priority;
+            std::string due_date;
+            std::string created_date;
+            std::string key;
+            std::string scratch;
+
+            void reset()
+            {
+                id = 0;
+                description.clear();
+                status.clear();
+                priority.clear();
+                due_date.clear();
+                created_date.clear();
+            }
+        };
 
-        // Find the opening bracket
-        pos = jsonContent.find('[');
-        if (pos == std::string::npos)
+        // Parses one object, fields in any order, cursor on the opening brace
+        bool parseObject(Cursor &cur, TaskFields &fields)
         {
-            std::cerr << "Invalid JSON: No opening bracket found" << std::endl;
-            return tasks;
+            fields.reset();
+            if (!cur.consume('{'))
+                return false;
+            if (cur.consume('}'))
+                return true;
+
+            do
+            {
+                if (!parseString(cur, fields.key) || !cur.consume(':'))
+                    return false;
+
+                const std::string &key = fields.key;
+                bool ok;
+                if (key == "id")
+                    ok = parseInt(cur, fields.id);
+                else if (key == "description")
+                    ok = parseString(cur, fields.description);
+                else if (key == "status")
+                    ok = parseString(cur, fields.status);
+                else if (key == "priority")
+                    ok = parseString(cur, fields.priority);
+                else if (key == "due_date")
+                    ok = parseString(cur, fields.due_date);
+                else if (key == "created_date")
+                    ok = parseString(cur, fields.created_date);
+                else
+                    ok = skipValue(cur, fields.scratch);
+
+                if (!ok)
+                    return false;
+            } while (cur.consume(','));
+
+            return cur.consume('}');
+        }
+
+        bool hasRequiredFields(const TaskFields &fields)
+        {
+            return fields.id > 0 && fields.id <= 0x7FFFFFFF && !fields.description.empty();
         }
-        pos++;
 
-        while (pos < jsonContent.length())
+        // Tasks are built a block at a time so each date column is validated in one call
+        const size_t BLOCK_SIZE = 256;
+
+        void flushBlock(std::vector<TaskFields> &block, size_t count, int32_t today, std::vector<Task> &tasks)
         {
-            // Skip whitespace
-            while (pos < jsonContent.length() && std::isspace(jsonContent[pos]))
+            std::string_view dueDates[BLOCK_SIZE];
+            std::string_view createdDates[BLOCK_SIZE];
+            int32_t dueDays[BLOCK_SIZE];
+            int32_t createdDays[BLOCK_SIZE];
+            for (size_t i = 0; i < count; ++i)
             {
-                pos++;
+                dueDates[i] = block[i].due_date;
+                createdDates[i] = block[i].created_date;
             }
 
-            // Check for end of array
-            if (pos >= jsonContent.length() || jsonContent[pos] == ']')
+            DateUtils::toDayNumbers(std::span(dueDates, count), std::span(dueDays, count));
+            DateUtils::toDayNumbers(std::span(createdDates, count), std::span(createdDays, count));
+
+            for (size_t i = 0; i < count; ++i)
             {
-                break;
+                TaskFields &fields = block[i];
+
+                // Same fallbacks as the string constructor and setters
+                TaskPriority priority = TaskPriority::Medium;
+                Task::parsePriority(fields.priority, priority);
+                if (dueDays[i] == DateUtils::NO_DATE && !fields.due_date.empty())
+                {
+                    std::cerr << "Warning: Invalid due date format. Due date cleared." << std::endl;
+                }
+
+                tasks.emplace_back(static_cast<int>(fields.id), std::move(fields.description),
+                                   TaskStatus::Pending, priority, dueDays[i],
+                                   createdDays[i] == DateUtils::NO_DATE ? today : createdDays[i]);
+                if (!fields.status.empty())
+                {
+                    tasks.back().setStatus(fields.status);
+                }
             }
+        }
 
-            // Find opening brace of object
-            if (jsonContent[pos] != '{')
+        Task makeTask(const TaskFields &fields)
+        {
+            Task task(static_cast<int>(fields.id), fields.description,
+                      fields.priority.empty() ? "medium" : fields.priority,
+                      fields.due_date, fields.created_date);
+            if (!fields.status.empty())
             {
-                std::cerr << "Invalid JSON: Expected '{' at position " << pos << std::endl;
-                break;
+                task.setStatus(fields.status);
             }
+            return task;
+        }
+    }
 
-            size_t objStart = pos;
-            size_t objEnd = jsonContent.find('}', objStart);
-            if (objEnd == std::string::npos)
+    bool parseTaskObject(const std::string &objectStr, Task &task)
+    {
+        Cursor cur{objectStr.data(), objectStr.data() + objectStr.size()};
+        TaskFields fields;
+        if (!parseObject(cur, fields) || !hasRequiredFields(fields))
+        {
+            return false;
+        }
+        task = makeTask(fields);
+        return true;
+    }
+
+    bool parseTasksFromJSON(const std::string &jsonContent, std::vector<Task> &tasks)
+    {
+        tasks.clear();
+        Cursor cur{jsonContent.data(), jsonContent.data() + jsonContent.size()};
+
+        cur.skipWhitespace();
+        if (cur.atEnd())
+        {
+            return true;
+        }
+
+        if (!cur.consume('['))
+        {
+            std::cerr << "Invalid JSON: No opening bracket found" << std::endl;
+            return false;
+        }
+
+        if (cur.consume(']'))
+        {
+            return cur.peek() == '\0';
+        }
+
+        std::vector<TaskFields> block(BLOCK_SIZE);
+        size_t pending = 0;
+        int32_t today = DateUtils::getCurrentDayNumber();
+        bool valid = true;
+        do
+        {
+            size_t position = static_cast<size_t>(cur.pos - jsonContent.data());
+            if (cur.peek() != '{')
             {
-                std::cerr << "Invalid JSON: No closing brace found" << std::endl;
+                std::cerr << "Invalid JSON: Expected '{' at position " << position << std::endl;
+                valid = false;
                 break;
             }
 
-            std::string objectStr = jsonContent.substr(objStart + 1, objEnd - objStart - 1);
-
-            // Parse the object
-            int id = extractIntField(objectStr, "id");
-            std::string description = extractStringField(objectStr, "description");
-            std::string status = extractStringField(objectStr, "status");
-            std::string priority = extractStringField(objectStr, "priority");
-            std::string due_date = extractStringField(objectStr, "due_date");
-            std::string created_date = extractStringField(objectStr, "created_date");
-
-            if (id > 0 && !description.empty())
+            if (!parseObject(cur, block[pending]))
             {
-                Task task(id, description, priority.empty() ? "medium" : priority, due_date, created_date);
-                if (!status.empty())
-                {
-                    task.setStatus(status);
-                }
-                tasks.push_back(task);
+                std::cerr << "Invalid JSON: Malformed task object near position " << position << std::endl;
+                valid = false;
+                break;
             }
 
-            pos = objEnd + 1;
+            // A task that cannot be loaded would be dropped by the next save
+            if (!hasRequiredFields(block[pending]))
+            {
+                std::cerr << "Invalid task at position " << position << ": needs an id and a description" << std::endl;
+                valid = false;
+                break;
+            }
 
-            // Skip comma if present
-            while (pos < jsonContent.length() && (std::isspace(jsonContent[pos]) || jsonContent[pos] == ','))
+            if (++pending == BLOCK_SIZE)
             {
-                pos++;
+                flushBlock(block, pending, today, tasks);
+                pending = 0;
             }
+        } while (cur.consume(','));
+        flushBlock(block, pending, today, tasks);
+
+        if (valid && (!cur.consume(']') || cur.peek() != '\0'))
+        {
+            std::cerr << "Invalid JSON: No closing bracket found" << std::endl;
+            valid = false;
         }
+        return valid;
+    }
 
+    std::vector<Task> parseTasksFromJSON(const std::string &jsonContent)
+    {
+        std::vector<Task> tasks;
+        parseTasksFromJSON(jsonContent, tasks);
         return tasks;
     }
 
+    std::string taskToJSONObject(const Task &task)
+    {
+        std::stringstream ss;
+        ss << "{\"id\":" << task.getId()
+           << ",\"description\":\"" << escapeJSON(task.getDescription()) << "\""
+           << ",\"status\":\"" << task.getStatus() << "\""
+           << ",\"priority\":\"" << task.getPriority() << "\""
+           << ",\"due_date\":\"" << task.getDueDate() << "\""
+           << ",\"created_date\":\"" << task.getCreatedDate() << "\"}";
+        return ss.str();
+    }
+
     std::string tasksToJSON(const std::vector<Task> &tasks)
     {
         std::stringstream ss;
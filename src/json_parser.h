@@ -7,8 +7,15 @@
 
 namespace JSONParser
 {
-    std::vector<Task> parseTasksFromJSON(const std::string &jsonContent);
+    // False if the content is malformed or holds a task that cannot be
+    // loaded; tasks then has everything before the error
+    bool parseTasksFromJSON(const std::string &jsonContent, std::vector<Task> &tasks);
+    std::vector<Task> parseTasksFromJSON(const std::string &jsonContent); // Ignores errors
     std::string tasksToJSON(const std::vector<Task> &tasks);
+
+    // Single-object helpers (used by the journal, one object per line)
+    bool parseTaskObject(const std::string &objectStr, Task &task);
+    std::string taskToJSONObject(const Task &task);
     std::string escapeJSON(const std::string &str);
     std::string unescapeJSON(const std::string &str);
 }
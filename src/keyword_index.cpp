@@ -0,0 +1,139 @@
+#include "keyword_index.h"
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    inline uint32_t foldByte(char c)
+    {
+        return static_cast<uint32_t>(std::tolower(static_cast<unsigned char>(c)));
+    }
+}
+
+void KeywordIndex::trigramsOf(std::string_view text, std::vector<uint32_t> &out)
+{
+    out.clear();
+    if (text.size() < MIN_KEYWORD_LENGTH)
+        return;
+
+    uint32_t window = (foldByte(text[0]) << 8) | foldByte(text[1]);
+    for (size_t i = 2; i < text.size(); ++i)
+    {
+        window = ((window << 8) | foldByte(text[i])) & 0xFFFFFF;
+        out.push_back(window);
+    }
+
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+void KeywordIndex::add(int id, std::string_view description)
+{
+    std::vector<uint32_t> trigrams;
+    trigramsOf(description, trigrams);
+
+    for (uint32_t trigram : trigrams)
+    {
+        std::vector<int> &ids = postings[trigram];
+
+        // New tasks get the highest ID so far, making this an append
+        if (ids.empty() || ids.back() < id)
+        {
+            ids.push_back(id);
+            continue;
+        }
+
+        auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if (it == ids.end() || *it != id)
+        {
+            ids.insert(it, id);
+        }
+    }
+}
+
+void KeywordIndex::remove(int id, std::string_view description)
+{
+    std::vector<uint32_t> trigrams;
+    trigramsOf(description, trigrams);
+
+    for (uint32_t trigram : trigrams)
+    {
+        auto found = postings.find(trigram);
+        if (found == postings.end())
+            continue;
+
+        std::vector<int> &ids = found->second;
+        auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if (it != ids.end() && *it == id)
+        {
+            ids.erase(it);
+        }
+        if (ids.empty())
+        {
+            postings.erase(found);
+        }
+    }
+}
+
+void KeywordIndex::clear()
+{
+    postings.clear();
+}
+
+bool KeywordIndex::candidates(std::string_view keyword_lower, std::vector<int> &ids) const
+{
+    ids.clear();
+    if (keyword_lower.size() < MIN_KEYWORD_LENGTH)
+        return false;
+
+    std::vector<uint32_t> trigrams;
+    trigramsOf(keyword_lower, trigrams);
+
+    std::vector<const std::vector<int> *> lists;
+    lists.reserve(trigrams.size());
+    for (uint32_t trigram : trigrams)
+    {
+        auto found = postings.find(trigram);
+        if (found == postings.end())
+            return true; // Some trigram occurs nowhere: no candidates
+        lists.push_back(&found->second);
+    }
+
+    // Walk the shortest list and probe the others with a moving lower bound
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<int> *a, const std::vector<int> *b)
+              { return a->size() < b->size(); });
+
+    std::vector<std::vector<int>::const_iterator> cursors;
+    cursors.reserve(lists.size());
+    for (const std::vector<int> *list : lists)
+    {
+        cursors.push_back(list->begin());
+    }
+
+    for (int id : *lists[0])
+    {
+        bool inAll = true;
+        for (size_t i = 1; i < lists.size(); ++i)
+        {
+            cursors[i] = std::lower_bound(cursors[i], lists[i]->end(), id);
+            if (cursors[i] == lists[i]->end())
+                return true; // Later IDs cannot be in this list either
+            if (*cursors[i] != id)
+            {
+                inAll = false;
+                break;
+            }
+        }
+        if (inAll)
+        {
+            ids.push_back(id);
+        }
+    }
+    return true;
+}
+
+size_t KeywordIndex::trigramCount() const
+{
+    return postings.size();
+}
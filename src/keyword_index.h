@@ -0,0 +1,36 @@
+#ifndef KEYWORD_INDEX_H
+#define KEYWORD_INDEX_H
+
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Inverted trigram index over task descriptions.
+//
+// Every case-folded 3-byte window of a description maps to the sorted IDs of
+// the tasks containing it. A keyword lookup intersects the postings of the
+// keyword's trigrams, smallest list first; the result is a superset of the
+// matches, so callers verify each candidate against the description.
+class KeywordIndex
+{
+private:
+    std::unordered_map<uint32_t, std::vector<int>> postings;
+
+    static void trigramsOf(std::string_view text, std::vector<uint32_t> &out);
+
+public:
+    static constexpr size_t MIN_KEYWORD_LENGTH = 3;
+
+    void add(int id, std::string_view description);
+    void remove(int id, std::string_view description);
+    void clear();
+
+    // Fills ids (ascending) with tasks that may contain keyword_lower. Returns
+    // false if the keyword is shorter than a trigram and the caller must scan.
+    bool candidates(std::string_view keyword_lower, std::vector<int> &ids) const;
+
+    size_t trigramCount() const;
+};
+
+#endif
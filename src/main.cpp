@@ -1,9 +1,15 @@
 #include <iostream>
 #include <vector>
 #include <string>
+#include <fstream>
+#include <charconv>
+#include <cstdlib>
 #include "task_manager.h"
 #include "command_handler.h"
 #include "interactive_mode.h"
+#include "batch_mode.h"
+#include "server.h"
+#include "daemon_client.h"
 
 std::vector<std::string> parseArguments(int argc, char *argv[])
 {
@@ -22,13 +28,167 @@ bool isInteractiveMode(const std::vector<std::string> &args)
     return (args[0] == "interactive" || args[0] == "-i" || args[0] == "--interactive");
 }
 
+bool isHelpCommand(const std::vector<std::string> &args)
+{
+    if (args.empty())
+        return true;
+    return (args[0] == "help" || args[0] == "--help" || args[0] == "-h");
+}
+
+bool isServeCommand(const std::vector<std::string> &args)
+{
+    return !args.empty() && args[0] == "serve";
+}
+
+bool isBatchCommand(const std::vector<std::string> &args)
+{
+    return !args.empty() && args[0] == "batch";
+}
+
+// The store is tasks.json unless $TASK_TRACKER_STORE names another file; a
+// .bin name selects the binary snapshot format. Exporting never changes it.
+std::string resolveStoreFile()
+{
+    const char *path = std::getenv("TASK_TRACKER_STORE");
+    return (path && *path) ? path : "tasks.json";
+}
+
+// "serve [--socket PATH] [--commit-window US]"
+bool parseServeOptions(const std::vector<std::string> &args, std::string &socketPath, int &commitWindowMicros)
+{
+    for (size_t i = 1; i < args.size(); i += 2)
+    {
+        if (args[i] != "--socket" && args[i] != "--commit-window")
+        {
+            std::cerr << "Error: Unexpected serve option '" << args[i] << "'." << std::endl;
+            std::cerr << "Usage: serve [--socket PATH] [--commit-window US]" << std::endl;
+            return false;
+        }
+        if (i + 1 >= args.size())
+        {
+            std::cerr << "Error: " << args[i] << " needs a value." << std::endl;
+            return false;
+        }
+
+        const std::string &value = args[i + 1];
+        if (args[i] == "--socket")
+        {
+            socketPath = value;
+            continue;
+        }
+        auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), commitWindowMicros);
+        if (value.empty() || ec != std::errc() || ptr != value.data() + value.size() || commitWindowMicros < -1)
+        {
+            std::cerr << "Error: --commit-window needs a number of microseconds (or -1)." << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// "batch FILE" or "batch -" (stdin). With a daemon live the commands are
+// sent to it over one connection; otherwise they run against one load.
+int runBatch(const std::vector<std::string> &args, const std::string &storeFile, const std::string &socketPath)
+{
+    if (args.size() < 2)
+    {
+        std::cerr << "Error: Please provide a script file, or - for stdin." << std::endl;
+        std::cerr << "Usage: batch <file|->" << std::endl;
+        return 1;
+    }
+
+    std::ifstream file;
+    if (args[1] != "-")
+    {
+        file.open(args[1]);
+        if (!file.is_open())
+        {
+            std::cerr << "Error: Cannot open batch file " << args[1] << std::endl;
+            return 1;
+        }
+    }
+    std::istream &input = args[1] == "-" ? std::cin : file;
+
+    if (Server::isListening(socketPath))
+    {
+        // The daemon commits on its own, so commit lines are dropped
+        std::vector<std::vector<std::string>> commands;
+        std::vector<std::string> command;
+        size_t lineNumber = 0;
+        while (BatchMode::nextCommand(input, command, lineNumber))
+        {
+            if (!BatchMode::isCommitCommand(command) && BatchMode::isAllowed(command, lineNumber))
+                commands.push_back(command);
+        }
+        if (DaemonClient::forwardAll(socketPath, commands) != DaemonClient::ForwardResult::Forwarded)
+            return 1;
+        std::cout << "Batch finished: " << commands.size() << " commands." << std::endl;
+        return 0;
+    }
+
+    TaskManager taskManager(storeFile);
+    BatchMode batchMode(taskManager);
+    return batchMode.run(input) ? 0 : 1;
+}
+
 int main(int argc, char *argv[])
 {
     try
     {
-        TaskManager taskManager;
         std::vector<std::string> args = parseArguments(argc, argv);
 
+        // Help never needs the task store, so don't pay for loading it
+        if (isHelpCommand(args))
+        {
+            CommandHandler::displayHelp();
+            return 0;
+        }
+
+        // With a daemon running, commands go to it instead of loading the store
+        std::string storeFile = resolveStoreFile();
+        std::string socketPath = DaemonClient::defaultSocketPath(storeFile);
+        int commitWindowMicros = 0;
+        if (isServeCommand(args))
+        {
+            if (!parseServeOptions(args, socketPath, commitWindowMicros))
+                return 1;
+        }
+        else if (isBatchCommand(args))
+        {
+            return runBatch(args, storeFile, socketPath);
+        }
+        else if (isInteractiveMode(args))
+        {
+            // A second process appending to the daemon's journal would race it
+            // for IDs, and the daemon's next checkpoint would erase its changes
+            if (Server::isListening(socketPath))
+            {
+                std::cerr << "Error: A daemon is serving this store on " << socketPath
+                          << "; stop it before starting interactive mode, or run commands one at a time." << std::endl;
+                return 1;
+            }
+        }
+        else
+        {
+            switch (DaemonClient::forward(socketPath, args))
+            {
+            case DaemonClient::ForwardResult::Forwarded:
+                return 0;
+            case DaemonClient::ForwardResult::Failed:
+                return 1;
+            case DaemonClient::ForwardResult::NoDaemon:
+                break;
+            }
+        }
+
+        TaskManager taskManager(storeFile);
+
+        if (isServeCommand(args))
+        {
+            Server server(taskManager, socketPath, commitWindowMicros);
+            return server.run() ? 0 : 1;
+        }
+
         // Check for interactive mode
         if (isInteractiveMode(args))
         {
@@ -39,13 +199,6 @@ int main(int argc, char *argv[])
 
         // Regular command mode
         CommandHandler commandHandler(taskManager);
-
-        if (args.empty())
-        {
-            commandHandler.displayHelp();
-            return 0;
-        }
-
         commandHandler.processCommand(args);
     }
     catch (const std::exception &e)
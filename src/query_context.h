@@ -0,0 +1,20 @@
+#ifndef QUERY_CONTEXT_H
+#define QUERY_CONTEXT_H
+
+#include <cstdint>
+#include "date_utils.h"
+
+// What a query is evaluated against. Captured once when a command starts and
+// passed down, so every row of a listing sees the same "today" and the clock
+// is read once per command rather than once per task.
+struct QueryContext
+{
+    int32_t today = 0; // Day number
+
+    static QueryContext capture()
+    {
+        return QueryContext{DateUtils::getCurrentDayNumber()};
+    }
+};
+
+#endif
@@ -0,0 +1,505 @@
+#include "server.h"
+#include "wire_protocol.h"
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sstream>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    void requestStop(int)
+    {
+        stopRequested = 1;
+    }
+
+    // SIGINT/SIGTERM stay blocked except inside epoll_pwait, so a stop
+    // request can't slip in between checking the flag and going to sleep.
+    void installSignalHandlers(sigset_t &waitMask)
+    {
+        struct sigaction action{};
+        action.sa_handler = requestStop;
+        sigemptyset(&action.sa_mask);
+        sigaction(SIGINT, &action, nullptr);
+        sigaction(SIGTERM, &action, nullptr);
+        std::signal(SIGPIPE, SIG_IGN); // A vanished client shows up as EPIPE instead
+
+        sigset_t stopSignals;
+        sigemptyset(&stopSignals);
+        sigaddset(&stopSignals, SIGINT);
+        sigaddset(&stopSignals, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &stopSignals, &waitMask);
+        sigdelset(&waitMask, SIGINT);
+        sigdelset(&waitMask, SIGTERM);
+    }
+
+    bool fillAddress(const std::string &path, sockaddr_un &address)
+    {
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(address.sun_path))
+            return false;
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+    // Points std::cout/std::cerr at string buffers for one command
+    class OutputCapture
+    {
+    private:
+        std::ostringstream out;
+        std::ostringstream err;
+        std::streambuf *savedOut;
+        std::streambuf *savedErr;
+
+    public:
+        OutputCapture() : savedOut(std::cout.rdbuf(out.rdbuf())), savedErr(std::cerr.rdbuf(err.rdbuf())) {}
+
+        ~OutputCapture()
+        {
+            std::cout.rdbuf(savedOut);
+            std::cerr.rdbuf(savedErr);
+        }
+
+        std::string response() const
+        {
+            return WireProtocol::encodeResponse(out.view(), err.view());
+        }
+    };
+}
+
+Server::Server(TaskManager &tm, const std::string &socketPath, int commitWindowMicros)
+    : taskManager(tm), commandHandler(tm), socketPath(socketPath),
+      listenFd(-1), epollFd(-1), wakeFd(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)), spareFd(-1), timerFd(-1),
+      commitWindowMicros(commitWindowMicros), outputHeld(false), timerArmed(false) {}
+
+Server::~Server()
+{
+    for (const auto &entry : connections)
+    {
+        ::close(entry.first);
+    }
+    for (int fd : {epollFd, wakeFd, spareFd, timerFd})
+    {
+        if (fd >= 0)
+            ::close(fd);
+    }
+    if (listenFd >= 0)
+    {
+        ::close(listenFd);
+        ::unlink(socketPath.c_str());
+    }
+}
+
+bool Server::isListening(const std::string &path)
+{
+    sockaddr_un address;
+    if (!fillAddress(path, address))
+        return false;
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0)
+        return false;
+    bool listening = ::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0;
+    ::close(fd);
+    return listening;
+}
+
+bool Server::bindSocket()
+{
+    sockaddr_un address;
+    if (!fillAddress(socketPath, address))
+    {
+        std::cerr << "Error: Invalid socket path: " << socketPath << std::endl;
+        return false;
+    }
+
+    // A socket file left by a daemon that did not shut down cleanly is
+    // replaced; a live one means another daemon owns this store.
+    struct stat info;
+    if (::lstat(socketPath.c_str(), &info) == 0)
+    {
+        if (!S_ISSOCK(info.st_mode))
+        {
+            std::cerr << "Error: " << socketPath << " exists and is not a socket." << std::endl;
+            return false;
+        }
+        if (isListening(socketPath))
+        {
+            std::cerr << "Error: A daemon is already listening on " << socketPath << std::endl;
+            return false;
+        }
+        ::unlink(socketPath.c_str());
+    }
+
+    listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listenFd < 0)
+    {
+        std::cerr << "Error: Cannot create socket: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    if (::bind(listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 ||
+        ::listen(listenFd, SOMAXCONN) < 0)
+    {
+        std::cerr << "Error: Cannot listen on " << socketPath << ": " << std::strerror(errno) << std::endl;
+        ::close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+    return true;
+}
+
+bool Server::setUpEventLoop()
+{
+    epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    timerFd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    spareFd = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+    if (epollFd < 0 || wakeFd < 0 || timerFd < 0)
+    {
+        std::cerr << "Error: Cannot set up the event loop: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    for (int fd : {listenFd, wakeFd, timerFd})
+    {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        if (::epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) < 0)
+        {
+            std::cerr << "Error: Cannot set up the event loop: " << std::strerror(errno) << std::endl;
+            return false;
+        }
+    }
+
+    taskManager.setDeferredJournalSync(commitWindowMicros >= 0);
+    return true;
+}
+
+bool Server::run()
+{
+    if (!bindSocket() || !setUpEventLoop())
+        return false;
+
+    sigset_t waitMask;
+    installSignalHandlers(waitMask);
+    std::cout << "Serving " << taskManager.getTaskCount() << " tasks on " << socketPath
+              << " (Ctrl+C to stop)" << std::endl;
+
+    const int MAX_EVENTS = 256;
+    epoll_event events[MAX_EVENTS];
+    bool running = true;
+    while (running && !stopRequested)
+    {
+        int ready = ::epoll_pwait(epollFd, events, MAX_EVENTS, -1, &waitMask);
+        if (ready < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            std::cerr << "Error: epoll_wait failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+
+        for (int i = 0; i < ready; ++i)
+        {
+            int fd = events[i].data.fd;
+            if (fd == listenFd)
+            {
+                acceptConnections();
+            }
+            else if (fd == wakeFd)
+            {
+                running = false;
+            }
+            else if (fd == timerFd)
+            {
+                uint64_t expirations;
+                (void)::read(timerFd, &expirations, sizeof(expirations));
+                timerArmed = false;
+                commit();
+            }
+            else
+            {
+                handleEvents(fd, events[i].events);
+            }
+        }
+        scheduleCommit();
+    }
+
+    commit();
+    if (!taskManager.setDeferredJournalSync(false))
+        std::cerr << "Error: Journal sync failed while stopping." << std::endl;
+    std::cout << "Daemon stopped." << std::endl;
+    return true;
+}
+
+void Server::scheduleCommit()
+{
+    if (!outputHeld || timerArmed)
+        return;
+    if (commitWindowMicros <= 0)
+    {
+        commit();
+        return;
+    }
+
+    itimerspec window{};
+    window.it_value.tv_sec = commitWindowMicros / 1000000;
+    window.it_value.tv_nsec = static_cast<long>(commitWindowMicros % 1000000) * 1000;
+    ::timerfd_settime(timerFd, 0, &window, nullptr);
+    timerArmed = true;
+}
+
+void Server::commit()
+{
+    if (!outputHeld)
+        return;
+    outputHeld = false;
+
+    // A failed sync leaves its callers without a reply; the client reports
+    // that the command may or may not have run
+    bool durable = taskManager.syncJournal();
+    if (!durable)
+        std::cerr << "Error: Journal sync failed; dropping unacknowledged clients." << std::endl;
+
+    std::vector<int> waiting;
+    for (const auto &entry : connections)
+    {
+        if (entry.second.sendable < entry.second.output.size())
+            waiting.push_back(entry.first);
+    }
+    for (int fd : waiting)
+    {
+        Connection &connection = connections[fd];
+        connection.sendable = connection.output.size();
+        if (!durable || !flushOutput(fd, connection) || (connection.closing && connection.output.empty()))
+        {
+            closeConnection(fd);
+            continue;
+        }
+        if (!updateInterest(fd, connection))
+            closeConnection(fd);
+    }
+}
+
+void Server::stop()
+{
+    uint64_t one = 1;
+    if (wakeFd >= 0)
+        (void)::write(wakeFd, &one, sizeof(one));
+}
+
+void Server::acceptConnections()
+{
+    while (true)
+    {
+        int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            if ((errno == EMFILE || errno == ENFILE) && spareFd >= 0)
+            {
+                // Out of descriptors: accept and drop one client so the
+                // level-triggered listener does not spin
+                std::cerr << "Warning: Too many open files; dropping a connection." << std::endl;
+                ::close(spareFd);
+                int dropped = ::accept(listenFd, nullptr, nullptr);
+                if (dropped >= 0)
+                    ::close(dropped);
+                spareFd = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                std::cerr << "Warning: accept failed: " << std::strerror(errno) << std::endl;
+            return;
+        }
+
+        Connection &connection = connections[fd];
+        if (!updateInterest(fd, connection))
+            closeConnection(fd);
+    }
+}
+
+void Server::handleEvents(int fd, uint32_t events)
+{
+    auto it = connections.find(fd);
+    if (it == connections.end())
+        return;
+    Connection &connection = it->second;
+
+    // A client that hung up while its replies await a commit cannot get them
+    if ((events & EPOLLERR) || ((events & EPOLLHUP) && connection.closing))
+    {
+        closeConnection(fd);
+        return;
+    }
+    if ((events & (EPOLLIN | EPOLLHUP)) && !readInput(fd, connection))
+        connection.closing = true; // Answer what was received, then close
+
+    // Requests left buffered by an earlier write stall run as soon as the
+    // output drains
+    while (true)
+    {
+        size_t buffered = connection.input.size();
+        processRequests(connection);
+        if (!flushOutput(fd, connection))
+        {
+            closeConnection(fd);
+            return;
+        }
+        if (!connection.output.empty() || connection.input.size() == buffered)
+            break;
+    }
+
+    if (connection.closing && connection.output.empty())
+    {
+        closeConnection(fd);
+        return;
+    }
+    if (!updateInterest(fd, connection))
+        closeConnection(fd);
+}
+
+bool Server::readInput(int fd, Connection &connection)
+{
+    char chunk[65536];
+    while (true)
+    {
+        ssize_t n = ::read(fd, chunk, sizeof(chunk));
+        if (n > 0)
+        {
+            connection.input.append(chunk, static_cast<size_t>(n));
+            if (static_cast<size_t>(n) < sizeof(chunk))
+                return true;
+            continue;
+        }
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return true;
+        return false; // EOF or error
+    }
+}
+
+void Server::processRequests(Connection &connection)
+{
+    size_t offset = 0;
+    std::string_view payload;
+    std::vector<std::string> args;
+    while (connection.output.size() - connection.outputOffset <= MAX_PENDING_OUTPUT)
+    {
+        WireProtocol::FrameStatus status = WireProtocol::takeFrame(connection.input, offset, payload);
+        if (status == WireProtocol::FrameStatus::Incomplete)
+            break;
+        if (status == WireProtocol::FrameStatus::Invalid || !WireProtocol::decodeRequest(payload, args))
+        {
+            bool held = connection.sendable < connection.output.size();
+            connection.output += WireProtocol::encodeResponse("", "Error: Malformed request.\n");
+            if (!held)
+                connection.sendable = connection.output.size();
+            connection.closing = true;
+            connection.input.clear();
+            return;
+        }
+        connection.output += execute(args);
+
+        // Replies wait while any mutation is unsynced: they may reflect it
+        if (taskManager.hasUnsyncedChanges())
+            outputHeld = true;
+        else
+            connection.sendable = connection.output.size();
+    }
+    connection.input.erase(0, offset);
+}
+
+bool Server::flushOutput(int fd, Connection &connection)
+{
+    while (connection.outputOffset < connection.sendable)
+    {
+        ssize_t n = ::send(fd, connection.output.data() + connection.outputOffset,
+                           connection.sendable - connection.outputOffset, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            return true;
+        if (n <= 0)
+            return false;
+        connection.outputOffset += static_cast<size_t>(n);
+    }
+    if (connection.outputOffset == connection.output.size())
+    {
+        connection.output.clear();
+        connection.outputOffset = 0;
+        connection.sendable = 0;
+    }
+    return true;
+}
+
+// False if epoll refused the change; the caller drops the connection
+bool Server::updateInterest(int fd, Connection &connection)
+{
+    uint32_t events = 0;
+    size_t pending = connection.output.size() - connection.outputOffset;
+    if (!connection.closing && pending <= MAX_PENDING_OUTPUT)
+        events |= EPOLLIN;
+    if (connection.sendable > connection.outputOffset)
+        events |= EPOLLOUT;
+    if (connection.registered && events == connection.events)
+        return true;
+
+    epoll_event event{};
+    event.events = events;
+    event.data.fd = fd;
+    if (::epoll_ctl(epollFd, connection.registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event) < 0)
+    {
+        std::cerr << "Warning: epoll_ctl failed: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    connection.registered = true;
+    connection.events = events;
+    return true;
+}
+
+void Server::closeConnection(int fd)
+{
+    ::epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    ::close(fd);
+    connections.erase(fd);
+}
+
+std::string Server::execute(const std::vector<std::string> &args)
+{
+    OutputCapture capture;
+    if (!args.empty() && args[0] == "serve")
+    {
+        std::cerr << "Error: Already running as a daemon." << std::endl;
+        return capture.response();
+    }
+    if (!args.empty() && args[0] == "batch")
+    {
+        std::cerr << "Error: Run batch from the CLI; it sends each line to the daemon." << std::endl;
+        return capture.response();
+    }
+
+    try
+    {
+        commandHandler.processCommand(args);
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+    }
+    return capture.response();
+}
@@ -0,0 +1,86 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "task_manager.h"
+#include "command_handler.h"
+
+// Keeps one TaskManager resident and runs CLI commands sent over a Unix
+// domain socket (framing in wire_protocol.h). Every mutation is journaled
+// before its response is sent, exactly as in a one-shot CLI run.
+//
+// One thread multiplexes all clients with epoll. Sockets are non-blocking
+// and each connection buffers its own input and output, so a client may
+// pipeline requests; responses come back in request order.
+//
+// Mutations are group-committed: journal records are buffered, and the
+// replies produced while any are unsynced are held until one fsync covers
+// them all. The commit window bounds how long the first of them waits for
+// company: 0 commits after each batch of ready events, a negative window
+// fsyncs every mutation on its own.
+class Server
+{
+private:
+    // Past this much unsent output a connection stops being read until the
+    // client catches up
+    static const size_t MAX_PENDING_OUTPUT = 1u << 20;
+
+    struct Connection
+    {
+        std::string input;
+        std::string output;
+        size_t outputOffset = 0;
+        size_t sendable = 0; // Output before this offset is committed
+        uint32_t events = 0;     // Interest currently set in epoll
+        bool registered = false; // Added to epoll (a 0 mask still counts)
+        bool closing = false; // Close once output is flushed
+    };
+
+    TaskManager &taskManager;
+    CommandHandler commandHandler;
+    std::string socketPath;
+    int listenFd;
+    int epollFd;
+    int wakeFd;  // eventfd written by stop()
+    int spareFd; // Released to accept-and-drop when out of descriptors
+    int timerFd; // Fires when the commit window closes
+    std::unordered_map<int, Connection> connections;
+    int commitWindowMicros;
+    bool outputHeld; // Some connection holds replies awaiting a commit
+    bool timerArmed;
+
+    bool bindSocket();
+    bool setUpEventLoop();
+    void acceptConnections();
+    void handleEvents(int fd, uint32_t events);
+    bool readInput(int fd, Connection &connection);
+    void processRequests(Connection &connection);
+    bool flushOutput(int fd, Connection &connection);
+    bool updateInterest(int fd, Connection &connection);
+    void closeConnection(int fd);
+    void scheduleCommit();
+    void commit();
+
+public:
+    Server(TaskManager &tm, const std::string &socketPath, int commitWindowMicros = 0);
+    ~Server();
+
+    Server(const Server &) = delete;
+    Server &operator=(const Server &) = delete;
+
+    // Serves until SIGINT/SIGTERM or stop(); false if the socket could not be opened
+    bool run();
+    void stop(); // Safe to call from another thread
+
+    // Runs one command and returns its response frame (stdout and stderr
+    // captured separately)
+    std::string execute(const std::vector<std::string> &args);
+
+    // True if a daemon is accepting connections on path
+    static bool isListening(const std::string &path);
+};
+
+#endif
@@ -0,0 +1,102 @@
+#include "shared_task_manager.h"
+#include <thread>
+
+SharedTaskManager::SharedTaskManager(const std::string &filename)
+    : primary(filename), mirror(primary), published(PRIMARY)
+{
+    // Readers must not build the lazy keyword index underneath each other
+    primary.prepareSharedReads();
+    mirror.prepareSharedReads();
+}
+
+int SharedTaskManager::pin() const
+{
+    // Count ourselves in, then check the side is still published: a writer
+    // that switched in between may already have seen a zero count
+    while (true)
+    {
+        int side = published.load();
+        readers[static_cast<size_t>(side)].value.fetch_add(1);
+        if (published.load() == side)
+            return side;
+        readers[static_cast<size_t>(side)].value.fetch_sub(1);
+    }
+}
+
+void SharedTaskManager::unpin(int side) const
+{
+    readers[static_cast<size_t>(side)].value.fetch_sub(1, std::memory_order_release);
+}
+
+void SharedTaskManager::publish(int side)
+{
+    // Store then load, mirrored by pin()'s increment then load: both sides
+    // must be seq_cst, or each could miss the other's write
+    published.store(side);
+    const ReaderCount &previous = readers[static_cast<size_t>(1 - side)];
+    while (previous.value.load(std::memory_order_seq_cst) != 0)
+    {
+        std::this_thread::yield();
+    }
+}
+
+int SharedTaskManager::addTask(const std::string &description, const std::string &priority,
+                               const std::string &due_date)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    publish(MIRROR);
+    int id = primary.addTask(description, priority, due_date);
+    publish(PRIMARY);
+
+    if (id != 0)
+        mirror.applyRecord({JournalRecord::Op::Put, id, *primary.findTaskById(id)});
+    return id;
+}
+
+bool SharedTaskManager::updateTask(int id, const std::string &description,
+                                   const std::string &status, const std::string &priority,
+                                   const std::string &due_date)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    publish(MIRROR);
+    bool updated = primary.updateTask(id, description, status, priority, due_date);
+    publish(PRIMARY);
+
+    if (updated)
+        mirror.applyRecord({JournalRecord::Op::Put, id, *primary.findTaskById(id)});
+    return updated;
+}
+
+bool SharedTaskManager::deleteTask(int id)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    publish(MIRROR);
+    bool deleted = primary.deleteTask(id);
+    publish(PRIMARY);
+
+    if (deleted)
+        mirror.applyRecord({JournalRecord::Op::Delete, id, Task()});
+    return deleted;
+}
+
+int SharedTaskManager::importTasks(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(writeMutex);
+    publish(MIRROR);
+    int count = primary.importTasks(path);
+    publish(PRIMARY);
+
+    if (count > 0)
+        mirror = primary;
+    return count;
+}
+
+bool SharedTaskManager::checkpoint()
+{
+    // Compacts the primary's store, so readers move off it first
+    std::lock_guard<std::mutex> lock(writeMutex);
+    publish(MIRROR);
+    bool saved = primary.checkpoint();
+    publish(PRIMARY);
+    return saved;
+}
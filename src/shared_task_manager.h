@@ -0,0 +1,71 @@
+#ifndef SHARED_TASK_MANAGER_H
+#define SHARED_TASK_MANAGER_H
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include "task_manager.h"
+
+// A TaskManager that many threads can read while one of them writes.
+//
+// Two replicas of the tasks and their indexes are kept (left-right). Readers
+// pin whichever replica is published and never wait for a writer. A writer
+// publishes the other replica, waits for the readers still pinning the first
+// one to leave (an epoch), changes it, and repeats the change on the other
+// side. Only the primary replica journals and saves; the mirror is updated
+// with applyRecord. Writers are serialized with each other.
+class SharedTaskManager
+{
+private:
+    static const int PRIMARY = 0;
+    static const int MIRROR = 1;
+
+    struct alignas(64) ReaderCount
+    {
+        std::atomic<size_t> value{0};
+    };
+
+    TaskManager primary;
+    TaskManager mirror;
+    std::atomic<int> published;
+    mutable std::array<ReaderCount, 2> readers;
+    std::mutex writeMutex;
+
+    int pin() const;
+    void unpin(int side) const;
+    // Makes side the one readers see and waits until none are left on the other
+    void publish(int side);
+
+public:
+    explicit SharedTaskManager(const std::string &filename = "tasks.json");
+
+    SharedTaskManager(const SharedTaskManager &) = delete;
+    SharedTaskManager &operator=(const SharedTaskManager &) = delete;
+
+    // Runs reader on a pinned replica and returns its result. Views obtained
+    // inside stay valid until reader returns; copy anything kept longer.
+    template <typename Reader>
+    auto read(Reader &&reader) const
+    {
+        struct Pin
+        {
+            const SharedTaskManager &owner;
+            int side;
+            ~Pin() { owner.unpin(side); }
+        } pinned{*this, pin()};
+        return reader(static_cast<const TaskManager &>(pinned.side == PRIMARY ? primary : mirror));
+    }
+
+    // Same behaviour and output as the TaskManager methods
+    int addTask(const std::string &description, const std::string &priority = "medium",
+                const std::string &due_date = "");
+    bool updateTask(int id, const std::string &description = "",
+                    const std::string &status = "", const std::string &priority = "",
+                    const std::string &due_date = "");
+    bool deleteTask(int id);
+    int importTasks(const std::string &path); // Copies the primary onto the mirror
+    bool checkpoint();
+};
+
+#endif
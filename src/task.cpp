@@ -3,78 +3,107 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <cctype>
+#include <utility>
 
-Task::Task() : id(0), description(""), status("pending"), priority("medium"), due_date(""), created_date("")
+namespace
+{
+    const std::string STATUS_NAMES[] = {"pending", "in_progress", "done"};
+    const std::string PRIORITY_NAMES[] = {"low", "medium", "high"};
+}
+
+Task::Task()
+    : description(""), id(0), due_date(DateUtils::NO_DATE), created_date(DateUtils::getCurrentDayNumber()),
+      status(TaskStatus::Pending), priority(TaskPriority::Medium)
 {
-    created_date = DateUtils::getCurrentDate();
 }
 
 Task::Task(int id, const std::string &description, const std::string &priority,
            const std::string &due_date, const std::string &created_date)
-    : id(id), description(description), status("pending"), priority(priority), due_date(due_date), created_date(created_date)
+    : description(description), id(id), due_date(DateUtils::NO_DATE), created_date(DateUtils::NO_DATE),
+      status(TaskStatus::Pending), priority(TaskPriority::Medium)
 {
+    // Invalid priorities fall back to medium
+    parsePriority(priority, this->priority);
 
-    if (!isValidPriority(priority))
+    if (!created_date.empty())
     {
-        this->priority = "medium";
+        this->created_date = DateUtils::toDayNumber(created_date);
     }
-
-    if (created_date.empty())
+    if (this->created_date == DateUtils::NO_DATE)
     {
-        this->created_date = DateUtils::getCurrentDate();
+        this->created_date = DateUtils::getCurrentDayNumber();
     }
 
     // Validate due_date if provided
-    if (!due_date.empty() && !DateUtils::isValidDate(due_date))
+    if (!due_date.empty())
     {
-        std::cerr << "Warning: Invalid due date format. Due date cleared." << std::endl;
-        this->due_date = "";
+        this->due_date = DateUtils::toDayNumber(due_date);
+        if (this->due_date == DateUtils::NO_DATE)
+        {
+            std::cerr << "Warning: Invalid due date format. Due date cleared." << std::endl;
+        }
     }
 }
 
+Task::Task(int id, std::string description, TaskStatus status, TaskPriority priority,
+           int32_t due_day, int32_t created_day)
+    : description(std::move(description)), id(id), due_date(due_day), created_date(created_day),
+      status(status), priority(priority)
+{
+}
+
 // Getters
 int Task::getId() const { return id; }
-std::string Task::getDescription() const { return description; }
-std::string Task::getStatus() const { return status; }
-std::string Task::getPriority() const { return priority; }
-std::string Task::getDueDate() const { return due_date; }
-std::string Task::getCreatedDate() const { return created_date; }
+const std::string &Task::getDescription() const { return description; }
+const std::string &Task::getStatus() const { return statusName(status); }
+const std::string &Task::getPriority() const { return priorityName(priority); }
+std::string Task::getDueDate() const { return DateUtils::formatDayNumber(due_date); }
+std::string Task::getCreatedDate() const { return DateUtils::formatDayNumber(created_date); }
+
+TaskStatus Task::getStatusCode() const { return status; }
+TaskPriority Task::getPriorityCode() const { return priority; }
+int32_t Task::getDueDay() const { return due_date; }
+int32_t Task::getCreatedDay() const { return created_date; }
+bool Task::hasDueDate() const { return due_date != DateUtils::NO_DATE; }
 
 // Setters
 void Task::setId(int id) { this->id = id; }
 void Task::setDescription(const std::string &description) { this->description = description; }
+void Task::setStatus(TaskStatus status) { this->status = status; }
+void Task::setPriority(TaskPriority priority) { this->priority = priority; }
+void Task::setDueDay(int32_t due_day) { this->due_date = due_day; }
 
 void Task::setStatus(const std::string &status)
 {
-    if (isValidStatus(status))
-    {
-        this->status = status;
-    }
-    else
+    if (!parseStatus(status, this->status))
     {
         std::cerr << "Invalid status: " << status << ". Using 'pending' instead." << std::endl;
-        this->status = "pending";
+        this->status = TaskStatus::Pending;
     }
 }
 
 void Task::setPriority(const std::string &priority)
 {
-    if (isValidPriority(priority))
-    {
-        this->priority = priority;
-    }
-    else
+    if (!parsePriority(priority, this->priority))
     {
         std::cerr << "Invalid priority: " << priority << ". Using 'medium' instead." << std::endl;
-        this->priority = "medium";
+        this->priority = TaskPriority::Medium;
     }
 }
 
 void Task::setDueDate(const std::string &due_date)
 {
-    if (due_date.empty() || DateUtils::isValidDate(due_date))
+    if (due_date.empty())
     {
-        this->due_date = due_date;
+        this->due_date = DateUtils::NO_DATE;
+        return;
+    }
+
+    int32_t day = DateUtils::toDayNumber(due_date);
+    if (day != DateUtils::NO_DATE)
+    {
+        this->due_date = day;
     }
     else
     {
@@ -84,66 +113,123 @@ void Task::setDueDate(const std::string &due_date)
 
 void Task::setCreatedDate(const std::string &created_date)
 {
-    if (DateUtils::isValidDate(created_date))
+    int32_t day = DateUtils::toDayNumber(created_date);
+    if (day != DateUtils::NO_DATE)
     {
-        this->created_date = created_date;
+        this->created_date = day;
     }
 }
 
 // Validation methods
 bool Task::isValidStatus(const std::string &status) const
 {
-    return (status == "pending" || status == "in_progress" || status == "done");
+    TaskStatus parsed;
+    return parseStatus(status, parsed);
 }
 
 bool Task::isValidPriority(const std::string &priority) const
 {
-    return (priority == "high" || priority == "medium" || priority == "low");
+    TaskPriority parsed;
+    return parsePriority(priority, parsed);
+}
+
+// String <-> enum conversion
+bool Task::parseStatus(const std::string &status, TaskStatus &out)
+{
+    if (status == "pending")
+        out = TaskStatus::Pending;
+    else if (status == "in_progress")
+        out = TaskStatus::InProgress;
+    else if (status == "done")
+        out = TaskStatus::Done;
+    else
+        return false;
+    return true;
+}
+
+bool Task::parsePriority(const std::string &priority, TaskPriority &out)
+{
+    if (priority == "high")
+        out = TaskPriority::High;
+    else if (priority == "medium")
+        out = TaskPriority::Medium;
+    else if (priority == "low")
+        out = TaskPriority::Low;
+    else
+        return false;
+    return true;
+}
+
+const std::string &Task::statusName(TaskStatus status)
+{
+    return STATUS_NAMES[static_cast<uint8_t>(status)];
+}
+
+const std::string &Task::priorityName(TaskPriority priority)
+{
+    return PRIORITY_NAMES[static_cast<uint8_t>(priority)];
 }
 
 // Utility methods
 bool Task::isDueToday() const
 {
-    if (due_date.empty())
-        return false;
-    return DateUtils::isDateEqual(due_date, DateUtils::getCurrentDate());
+    return isDueToday(DateUtils::getCurrentDayNumber());
 }
 
 bool Task::isOverdue() const
 {
-    if (due_date.empty())
-        return false;
-    return DateUtils::isDateBefore(due_date, DateUtils::getCurrentDate());
+    return isOverdue(DateUtils::getCurrentDayNumber());
 }
 
 int Task::getDaysUntilDue() const
 {
-    if (due_date.empty())
+    return getDaysUntilDue(DateUtils::getCurrentDayNumber());
+}
+
+bool Task::isDueToday(int32_t today) const
+{
+    return hasDueDate() && due_date == today;
+}
+
+bool Task::isOverdue(int32_t today) const
+{
+    return hasDueDate() && due_date < today;
+}
+
+int Task::getDaysUntilDue(int32_t today) const
+{
+    if (!hasDueDate())
         return -1;
-    return DateUtils::daysBetween(DateUtils::getCurrentDate(), due_date);
+    return due_date - today;
 }
 
 bool Task::matchesKeyword(const std::string &keyword) const
 {
-    std::string desc_lower = description;
     std::string keyword_lower = keyword;
-
-    std::transform(desc_lower.begin(), desc_lower.end(), desc_lower.begin(), ::tolower);
     std::transform(keyword_lower.begin(), keyword_lower.end(), keyword_lower.begin(), ::tolower);
+    return matchesLowercaseKeyword(keyword_lower);
+}
 
-    return desc_lower.find(keyword_lower) != std::string::npos;
+bool Task::matchesLowercaseKeyword(std::string_view keyword_lower) const
+{
+    // Case-insensitive substring search without lowercasing a copy of the description
+    auto it = std::search(description.begin(), description.end(),
+                          keyword_lower.begin(), keyword_lower.end(),
+                          [](char a, char b)
+                          { return std::tolower(static_cast<unsigned char>(a)) == b; });
+    return it != description.end() || keyword_lower.empty();
 }
 
 std::string Task::toString() const
 {
     std::stringstream ss;
     ss << "ID: " << id << ", Description: " << description
-       << ", Status: " << status << ", Priority: " << priority;
-    if (!due_date.empty())
+       << ", Status: " << getStatus() << ", Priority: " << getPriority();
+    if (hasDueDate())
     {
-        ss << ", Due: " << due_date;
+        ss << ", Due: " << getDueDate();
     }
-    ss << ", Created: " << created_date;
+    ss << ", Created: " << getCreatedDate();
     return ss.str();
 }
 
@@ -1,31 +1,60 @@
 #ifndef TASK_H
 #define TASK_H
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
+
+// Enumerators are ordered so that integer comparison matches the natural order
+// (and the on-disk codes used by the binary snapshot).
+enum class TaskStatus : uint8_t
+{
+    Pending = 0,
+    InProgress = 1,
+    Done = 2
+};
+
+enum class TaskPriority : uint8_t
+{
+    Low = 0,
+    Medium = 1,
+    High = 2
+};
 
 class Task {
 private:
-    int id;
     std::string description;
-    std::string status;       // "pending", "in_progress", "done"
-    std::string priority;     // "high", "medium", "low"
-    std::string due_date;     // ISO format: "YYYY-MM-DD" (optional)
-    std::string created_date; // ISO format: "YYYY-MM-DD"
+    int id;
+    int32_t due_date;     // Day number (DateUtils::NO_DATE if unset)
+    int32_t created_date; // Day number
+    TaskStatus status;
+    TaskPriority priority;
 
 public:
     // Constructors
     Task();
-    Task(int id, const std::string& description, const std::string& priority = "medium", 
+    Task(int id, const std::string& description, const std::string& priority = "medium",
          const std::string& due_date = "", const std::string& created_date = "");
+    // Pre-validated fields (snapshot loading, bulk construction)
+    Task(int id, std::string description, TaskStatus status, TaskPriority priority,
+         int32_t due_day, int32_t created_day);
 
     // Getters
     int getId() const;
-    std::string getDescription() const;
-    std::string getStatus() const;
-    std::string getPriority() const;
+    const std::string& getDescription() const;
+    const std::string& getStatus() const;
+    const std::string& getPriority() const;
     std::string getDueDate() const;
     std::string getCreatedDate() const;
 
+    // Compact accessors
+    TaskStatus getStatusCode() const;
+    TaskPriority getPriorityCode() const;
+    int32_t getDueDay() const;
+    int32_t getCreatedDay() const;
+    bool hasDueDate() const;
+
     // Setters
     void setId(int id);
     void setDescription(const std::string& description);
@@ -33,22 +62,40 @@ public:
     void setPriority(const std::string& priority);
     void setDueDate(const std::string& due_date);
     void setCreatedDate(const std::string& created_date);
+    void setStatus(TaskStatus status);
+    void setPriority(TaskPriority priority);
+    void setDueDay(int32_t due_day);
 
     // Validation methods
     bool isValidStatus(const std::string& status) const;
     bool isValidPriority(const std::string& priority) const;
 
+    // String <-> enum conversion
+    static bool parseStatus(const std::string& status, TaskStatus& out);
+    static bool parsePriority(const std::string& priority, TaskPriority& out);
+    static const std::string& statusName(TaskStatus status);
+    static const std::string& priorityName(TaskPriority priority);
+
     // Utility methods
     bool isDueToday() const;
     bool isOverdue() const;
     int getDaysUntilDue() const;
+    bool isDueToday(int32_t today) const; // today as a day number
+    bool isOverdue(int32_t today) const;
+    int getDaysUntilDue(int32_t today) const;
     bool matchesKeyword(const std::string& keyword) const;
+    bool matchesLowercaseKeyword(std::string_view keyword_lower) const; // No allocation
     std::string toString() const;
-    
+
     // Comparison operators for sorting
     bool operator<(const Task& other) const;
     bool operator>(const Task& other) const;
     bool operator==(const Task& other) const;
 };
 
-#endif
\ No newline at end of file
+// Non-owning list of tasks. Views taken from a TaskManager point into its
+// store: they keep the store's (insertion) order and stay valid until the
+// next add/update/delete.
+using TaskView = std::vector<const Task *>;
+
+#endif
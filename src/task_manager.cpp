@@ -2,29 +2,72 @@
 #include "json_parser.h"
 #include "date_utils.h"
 #include "filter_utils.h"
+#include "binary_snapshot.h"
+#include "durable_file.h"
+#include "column_filter.h"
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <cstdio>
+#include <limits>
+#include <functional>
+
+namespace
+{
+    // Never checkpoint before the journal reaches this size, however small the snapshot
+    const size_t MIN_CHECKPOINT_BYTES = 1024 * 1024;
+
+    // Lower bound of an open-ended due range (NO_DATE itself is never indexed)
+    const int32_t EARLIEST_DAY = DateUtils::NO_DATE + 1;
+
+    // Walking index candidates costs an ID lookup and a full predicate check
+    // per candidate (20-60 ns); the column kernel costs well under 1 ns per
+    // slot. Index candidates win only while there are fewer than one per this
+    // many slots (bench_query_plan).
+    const size_t SLOTS_PER_INDEX_CANDIDATE = 128;
+
+    // Narrows [first, last] to the due days the predicate allows. Returns false
+    // if the predicate has no date constraint.
+    bool dueBounds(const FilterUtils::TaskPredicate &predicate, int32_t &first, int32_t &last)
+    {
+        ColumnFilter::FieldPredicate fields = ColumnFilter::lower(predicate);
+        first = fields.due_first;
+        last = fields.due_last;
+        return fields.check_due;
+    }
+}
 
 TaskManager::TaskManager(const std::string &filename)
-    : filename(filename), nextId(1)
+    : filename(filename), nextId(1), journal(filename + ".journal"), snapshotBytes(0), loadFailed(false),
+      keywordIndexReady(false), keywordScanned(false)
 {
     loadTasks();
 }
 
-void TaskManager::addTask(const std::string &description, const std::string &priority,
-                          const std::string &due_date)
+int TaskManager::addTask(const std::string &description, const std::string &priority,
+                         const std::string &due_date)
 {
     if (description.empty())
     {
         std::cerr << "Error: Task description cannot be empty." << std::endl;
-        return;
+        return 0;
+    }
+    if (!checkWritable())
+    {
+        return 0;
     }
 
+    // Journaled first: a change that cannot be recorded is not made at all
+    Task task(nextId, description, priority, due_date);
+    if (!journal.appendPut(task))
+    {
+        std::cerr << "Error: Task not added." << std::endl;
+        return 0;
+    }
     int id = generateNextId();
-    Task task(id, description, priority, due_date);
-    tasks.push_back(task);
-    saveTasks();
+    store.put(task);
+    indexAdd(task);
+    maybeCheckpoint();
 
     std::cout << "Task added successfully with ID: " << id;
     if (!priority.empty() && priority != "medium")
@@ -36,130 +79,403 @@ void TaskManager::addTask(const std::string &description, const std::string &pri
         std::cout << " (Due: " << due_date << ")";
     }
     std::cout << std::endl;
+    return id;
 }
 
 bool TaskManager::updateTask(int id, const std::string &description,
                              const std::string &status, const std::string &priority,
                              const std::string &due_date)
 {
-    Task *task = findTaskById(id);
+    const Task *task = findTaskById(id);
     if (task == nullptr)
     {
         std::cerr << "Error: Task with ID " << id << " not found." << std::endl;
         return false;
     }
 
-    bool updated = false;
+    // Validate everything first so a rejected update changes nothing
+    if (!status.empty() && !task->isValidStatus(status))
+    {
+        std::cerr << "Error: Invalid status '" << status << "'. Valid statuses are: pending, in_progress, done" << std::endl;
+        return false;
+    }
 
-    if (!description.empty())
+    if (!priority.empty() && !task->isValidPriority(priority))
     {
-        task->setDescription(description);
-        updated = true;
+        std::cerr << "Error: Invalid priority '" << priority << "'. Valid priorities are: high, medium, low" << std::endl;
+        return false;
     }
 
-    if (!status.empty())
+    if (!due_date.empty() && !DateUtils::isValidDate(due_date))
     {
-        if (!task->isValidStatus(status))
-        {
-            std::cerr << "Error: Invalid status '" << status << "'. Valid statuses are: pending, in_progress, done" << std::endl;
-            return false;
-        }
-        task->setStatus(status);
-        updated = true;
+        std::cerr << "Error: Invalid date format '" << due_date << "'. Please use YYYY-MM-DD format." << std::endl;
+        return false;
     }
 
-    if (!priority.empty())
+    if (description.empty() && status.empty() && priority.empty() && due_date.empty())
     {
-        if (!task->isValidPriority(priority))
-        {
-            std::cerr << "Error: Invalid priority '" << priority << "'. Valid priorities are: high, medium, low" << std::endl;
-            return false;
-        }
-        task->setPriority(priority);
-        updated = true;
+        return false;
+    }
+    if (!checkWritable())
+    {
+        return false;
     }
 
+    // Changes go through the store so its columns stay in step
+    Task updated = *task;
+    if (!description.empty())
+    {
+        updated.setDescription(description);
+    }
+    if (!status.empty())
+    {
+        updated.setStatus(status);
+    }
+    if (!priority.empty())
+    {
+        updated.setPriority(priority);
+    }
     if (!due_date.empty())
     {
-        if (!DateUtils::isValidDate(due_date))
+        updated.setDueDate(due_date);
+    }
+    if (!journal.appendPut(updated))
+    {
+        std::cerr << "Error: Task " << id << " not updated." << std::endl;
+        return false;
+    }
+    indexRemove(*task);
+    store.put(updated);
+    indexAdd(updated);
+    maybeCheckpoint();
+    std::cout << "Task " << id << " updated successfully." << std::endl;
+    return true;
+}
+
+bool TaskManager::deleteTask(int id)
+{
+    const Task *task = store.find(id);
+    if (task == nullptr)
+    {
+        std::cerr << "Error: Task with ID " << id << " not found." << std::endl;
+        return false;
+    }
+    if (!checkWritable())
+    {
+        return false;
+    }
+
+    if (!journal.appendDelete(id))
+    {
+        std::cerr << "Error: Task " << id << " not deleted." << std::endl;
+        return false;
+    }
+    indexRemove(*task);
+    store.erase(id);
+    maybeCheckpoint();
+    std::cout << "Task " << id << " deleted successfully." << std::endl;
+    return true;
+}
+
+TaskView TaskManager::viewAllTasks() const
+{
+    return store.view();
+}
+
+TaskView TaskManager::viewTasksByStatus(const std::string &status) const
+{
+    if (status.empty())
+    {
+        return store.view();
+    }
+    return viewTasksMatching(FilterUtils::compileCriteria(QueryContext(), "", "", status));
+}
+
+TaskView TaskManager::viewTasksByPriority(const std::string &priority) const
+{
+    if (priority.empty())
+    {
+        return store.view();
+    }
+    return viewTasksMatching(FilterUtils::compileCriteria(QueryContext(), "", priority));
+}
+
+TaskView TaskManager::viewTasksByKeyword(const std::string &keyword) const
+{
+    // No date criteria, so the context (and the clock) is not needed
+    return viewTasksMatching(FilterUtils::compileCriteria(QueryContext(), keyword));
+}
+
+TaskView TaskManager::viewTasksDueBy(const std::string &date) const
+{
+    int32_t day = DateUtils::toDayNumber(date);
+    if (day == DateUtils::NO_DATE)
+    {
+        return TaskView();
+    }
+    return viewDueRange(EARLIEST_DAY, day);
+}
+
+TaskView TaskManager::viewTasksDueBetween(const std::string &start_date, const std::string &end_date) const
+{
+    int32_t first = DateUtils::toDayNumber(start_date);
+    int32_t last = DateUtils::toDayNumber(end_date);
+    if (first == DateUtils::NO_DATE || last == DateUtils::NO_DATE)
+    {
+        return TaskView();
+    }
+    return viewDueRange(first, last);
+}
+
+TaskView TaskManager::viewOverdueTasks(const QueryContext &context) const
+{
+    return viewDueRange(EARLIEST_DAY, context.today - 1);
+}
+
+TaskView TaskManager::viewTasksDueToday(const QueryContext &context) const
+{
+    return viewDueRange(context.today, context.today);
+}
+
+TaskView TaskManager::viewDueRange(int32_t first, int32_t last) const
+{
+    std::vector<int> ids;
+    for (const DueIndex::Entry &entry : dueIndex.range(first, last))
+    {
+        ids.push_back(entry.id);
+    }
+    return viewOfIds(ids);
+}
+
+TaskView TaskManager::viewTasksSorted(const std::string &sort_by, bool ascending) const
+{
+    return FilterUtils::sortBy(store.view(), sort_by, ascending);
+}
+
+TaskView TaskManager::viewTasksFilteredAndSorted(const QueryContext &context,
+                                                 const std::string &sort_by,
+                                                 bool ascending,
+                                                 const std::string &keyword,
+                                                 const std::string &priority,
+                                                 const std::string &status,
+                                                 const std::string &due_date,
+                                                 bool overdue_only,
+                                                 bool due_today_only) const
+{
+    TaskView result = viewTasksMatching(FilterUtils::compileCriteria(context, keyword, priority, status, due_date,
+                                                                     overdue_only, due_today_only));
+    if (!sort_by.empty())
+    {
+        result = FilterUtils::sortBy(std::move(result), sort_by, ascending);
+    }
+    return result;
+}
+
+TaskView TaskManager::viewTasksMatching(const FilterUtils::TaskPredicate &predicate) const
+{
+    TaskView filtered;
+    if (predicate.match_none)
+    {
+        return filtered;
+    }
+
+    // A keyword narrows the candidates through the index when it can
+    if (!predicate.keyword_lower.empty() && keywordCandidates(predicate.keyword_lower, filtered))
+    {
+        filtered.erase(std::remove_if(filtered.begin(), filtered.end(),
+                                      [&predicate](const Task *task)
+                                      { return !predicate.matches(*task); }),
+                       filtered.end());
+        return filtered;
+    }
+
+    // Broad constraints are cheaper to test slot by slot than to gather
+    if (prefersColumnScan(predicate))
+    {
+        return scanColumns(predicate);
+    }
+
+    // Otherwise walk whichever candidate set is smaller: the due range, or
+    // the status/priority bitmaps ANDed together
+    int32_t first = 0;
+    int32_t last = 0;
+    bool byDue = dueBounds(predicate, first, last);
+    if (byDue && dueIndex.countInRange(first, last) <= selectionCount(predicate))
+    {
+        filtered = viewDueRange(first, last);
+    }
+    else
+    {
+        const Bitmap &statusSet = statusIndex[static_cast<size_t>(predicate.status)];
+        const Bitmap &prioritySet = priorityIndex[static_cast<size_t>(predicate.priority)];
+        Bitmap combined;
+        const Bitmap *selection = &statusSet;
+        if (predicate.check_status && predicate.check_priority)
         {
-            std::cerr << "Error: Invalid date format '" << due_date << "'. Please use YYYY-MM-DD format." << std::endl;
-            return false;
+            combined = statusSet & prioritySet;
+            selection = &combined;
         }
-        task->setDueDate(due_date);
-        updated = true;
+        else if (predicate.check_priority)
+        {
+            selection = &prioritySet;
+        }
+
+        std::vector<int> ids;
+        ids.reserve(selection->cardinality());
+        selection->forEach([&ids](uint32_t id)
+                           { ids.push_back(static_cast<int>(id)); });
+        filtered = viewOfIds(ids);
     }
 
-    if (updated)
+    filtered.erase(std::remove_if(filtered.begin(), filtered.end(),
+                                  [&predicate](const Task *task)
+                                  { return !predicate.matches(*task); }),
+                   filtered.end());
+    return filtered;
+}
+
+size_t TaskManager::selectionCount(const FilterUtils::TaskPredicate &predicate) const
+{
+    if (predicate.check_status && predicate.check_priority)
+        return stats.countByStatusAndPriority(predicate.status, predicate.priority);
+    if (predicate.check_status)
+        return stats.countByStatus(predicate.status);
+    if (predicate.check_priority)
+        return stats.countByPriority(predicate.priority);
+    return std::numeric_limits<size_t>::max();
+}
+
+bool TaskManager::prefersColumnScan(const FilterUtils::TaskPredicate &predicate) const
+{
+    size_t candidates = selectionCount(predicate);
+    int32_t first = 0;
+    int32_t last = 0;
+    if (dueBounds(predicate, first, last))
     {
-        saveTasks();
-        std::cout << "Task " << id << " updated successfully." << std::endl;
+        candidates = std::min(candidates, dueIndex.countInRange(first, last));
     }
+    if (candidates == std::numeric_limits<size_t>::max())
+        return true; // No index applies
 
-    return updated;
+    return candidates >= store.columns().id.size() / SLOTS_PER_INDEX_CANDIDATE;
 }
 
-bool TaskManager::deleteTask(int id)
+TaskView TaskManager::scanColumns(const FilterUtils::TaskPredicate &predicate, bool first_only) const
+{
+    // The field checks run block by block as column kernels; rows (and the
+    // description text) are touched only for slots they select
+    TaskView filtered;
+    TaskStore::Columns columns = store.columns();
+    const std::vector<Task> &rows = store.rows();
+    ColumnFilter::FieldPredicate fields = ColumnFilter::lower(predicate);
+    uint64_t selection[ColumnFilter::BLOCK_SLOTS / 64];
+
+    for (size_t begin = 0; begin < columns.id.size(); begin += ColumnFilter::BLOCK_SLOTS)
+    {
+        size_t end = std::min(columns.id.size(), begin + ColumnFilter::BLOCK_SLOTS);
+        ColumnFilter::select(fields, columns, begin, end, selection);
+
+        for (size_t w = 0; w < (end - begin + 63) / 64; ++w)
+        {
+            for (uint64_t word = selection[w]; word != 0; word &= word - 1)
+            {
+                size_t slot = begin + w * 64 + static_cast<size_t>(__builtin_ctzll(word));
+                if (!predicate.keyword_lower.empty() &&
+                    store.descriptionLower(slot).find(predicate.keyword_lower) == std::string_view::npos)
+                    continue;
+
+                filtered.push_back(&rows[slot]);
+                if (first_only)
+                    return filtered;
+            }
+        }
+    }
+    return filtered;
+}
+
+bool TaskManager::viewTasksPage(const FilterUtils::TaskPredicate &predicate,
+                                const std::vector<FilterUtils::SortKey> &keys,
+                                const FilterUtils::PageRequest &page,
+                                FilterUtils::TaskPage &out) const
 {
-    auto it = std::find_if(tasks.begin(), tasks.end(),
-                           [id](const Task &task)
-                           { return task.getId() == id; });
+    using FilterUtils::SortField;
+    bool dueOrder = keys.size() == 2 &&
+                    keys[0].field == SortField::DueDate && keys[0].ascending &&
+                    keys[1].field == SortField::Id && keys[1].ascending;
+    size_t needed = page.offset + page.limit + 1;
+    if (!dueOrder || page.limit == 0 || needed < page.limit || !page.after.empty() ||
+        !predicate.keyword_lower.empty() || predicate.match_none)
+    {
+        return FilterUtils::paginate(viewTasksMatching(predicate), keys, page, out);
+    }
 
-    if (it == tasks.end())
+    // The due index is already in (day, ID) order, so stop as soon as the page is full
+    TaskView ordered;
+    int32_t first = 0;
+    int32_t last = 0;
+    bool byDue = dueBounds(predicate, first, last);
+    for (const DueIndex::Entry &entry : dueIndex.range(first, last))
     {
-        std::cerr << "Error: Task with ID " << id << " not found." << std::endl;
-        return false;
+        const Task *task = store.find(entry.id);
+        if (task != nullptr && predicate.matches(*task))
+        {
+            ordered.push_back(task);
+            if (ordered.size() == needed)
+                break;
+        }
     }
 
-    tasks.erase(it);
-    saveTasks();
-    std::cout << "Task " << id << " deleted successfully." << std::endl;
+    // Undated tasks come after every dated one
+    if (ordered.size() < needed && !byDue)
+    {
+        TaskView undated;
+        store.forEach([&undated, &predicate](const Task &task)
+                      {
+            if (!task.hasDueDate() && predicate.matches(task))
+            {
+                undated.push_back(&task);
+            } });
+        undated = FilterUtils::sortTopK(std::move(undated), keys, needed - ordered.size());
+        ordered.insert(ordered.end(), undated.begin(), undated.end());
+    }
+
+    out = FilterUtils::pageOf(ordered, keys, page);
     return true;
 }
 
 std::vector<Task> TaskManager::getAllTasks() const
 {
-    return tasks;
+    return store.liveTasks();
 }
 
 std::vector<Task> TaskManager::getTasksByStatus(const std::string &status) const
 {
-    return FilterUtils::filterByStatus(tasks, status);
+    return FilterUtils::materialize(viewTasksByStatus(status));
 }
 
 std::vector<Task> TaskManager::getTasksByPriority(const std::string &priority) const
 {
-    return FilterUtils::filterByPriority(tasks, priority);
+    return FilterUtils::materialize(viewTasksByPriority(priority));
 }
 
 std::vector<Task> TaskManager::searchTasksByKeyword(const std::string &keyword) const
 {
-    return FilterUtils::filterByKeyword(tasks, keyword);
+    return FilterUtils::materialize(viewTasksByKeyword(keyword));
 }
 
 std::vector<Task> TaskManager::getTasksDueBy(const std::string &date) const
 {
-    std::vector<Task> filtered;
-    for (const Task &task : tasks)
-    {
-        if (!task.getDueDate().empty() &&
-            (DateUtils::isDateEqual(task.getDueDate(), date) ||
-             DateUtils::isDateBefore(task.getDueDate(), date)))
-        {
-            filtered.push_back(task);
-        }
-    }
-    return filtered;
+    return FilterUtils::materialize(viewTasksDueBy(date));
 }
 
 std::vector<Task> TaskManager::getOverdueTasks() const
 {
-    return FilterUtils::filterOverdue(tasks);
+    return FilterUtils::materialize(viewOverdueTasks(QueryContext::capture()));
 }
 
 std::vector<Task> TaskManager::getTasksDueToday() const
 {
-    return FilterUtils::filterDueToday(tasks);
+    return FilterUtils::materialize(viewTasksDueToday(QueryContext::capture()));
 }
 
 std::vector<Task> TaskManager::getTasksFiltered(const std::string &keyword,
@@ -169,52 +485,140 @@ std::vector<Task> TaskManager::getTasksFiltered(const std::string &keyword,
                                                 bool overdue_only,
                                                 bool due_today_only) const
 {
-    return FilterUtils::filterByCriteria(tasks, keyword, priority, status,
-                                         due_date, overdue_only, due_today_only);
+    return FilterUtils::materialize(viewTasksMatching(FilterUtils::compileCriteria(QueryContext::capture(), keyword, priority,
+                                                                                   status, due_date, overdue_only, due_today_only)));
 }
 
 std::vector<Task> TaskManager::getTasksSorted(const std::string &sort_by, bool ascending) const
 {
-    std::vector<Task> sorted_tasks = tasks;
+    return FilterUtils::materialize(viewTasksSorted(sort_by, ascending));
+}
+
+std::vector<Task> TaskManager::getTasksFilteredAndSorted(const std::string &sort_by,
+                                                         bool ascending,
+                                                         const std::string &keyword,
+                                                         const std::string &priority,
+                                                         const std::string &status,
+                                                         const std::string &due_date,
+                                                         bool overdue_only,
+                                                         bool due_today_only) const
+{
+    return FilterUtils::materialize(viewTasksFilteredAndSorted(QueryContext::capture(), sort_by, ascending, keyword,
+                                                               priority, status, due_date, overdue_only, due_today_only));
+}
 
-    if (sort_by == "priority")
+bool TaskManager::keywordCandidates(const std::string &keyword_lower, TaskView &out) const
+{
+    if (keyword_lower.size() < KeywordIndex::MIN_KEYWORD_LENGTH)
+        return false;
+
+    if (!keywordIndexReady)
     {
-        return FilterUtils::sortByPriority(sorted_tasks, ascending);
+        if (!keywordScanned)
+        {
+            keywordScanned = true;
+            return false;
+        }
+
+        buildKeywordIndex();
     }
-    else if (sort_by == "due_date" || sort_by == "due")
+
+    std::vector<int> ids;
+    keywordIndex.candidates(keyword_lower, ids);
+    out = viewOfIds(ids);
+    return true;
+}
+
+TaskView TaskManager::viewOfIds(const std::vector<int> &ids) const
+{
+    TaskView view;
+    view.reserve(ids.size());
+    for (int id : ids)
     {
-        return FilterUtils::sortByDueDate(sorted_tasks, ascending);
+        if (const Task *task = store.find(id))
+            view.push_back(task);
     }
-    else if (sort_by == "status")
+
+    // Tasks live in one array, so address order is the store's insertion order.
+    // That is usually ID order already.
+    if (!std::is_sorted(view.begin(), view.end(), std::less<const Task *>()))
     {
-        return FilterUtils::sortByStatus(sorted_tasks, ascending);
+        std::sort(view.begin(), view.end(), std::less<const Task *>());
     }
-    else if (sort_by == "id")
+    return view;
+}
+
+void TaskManager::indexAdd(const Task &task)
+{
+    uint32_t id = static_cast<uint32_t>(task.getId());
+    statusIndex[static_cast<size_t>(task.getStatusCode())].add(id);
+    priorityIndex[static_cast<size_t>(task.getPriorityCode())].add(id);
+    stats.add(task);
+    if (task.hasDueDate())
+        dueIndex.insert(task.getDueDay(), task.getId());
+
+    if (keywordIndexReady)
+        keywordIndex.add(task.getId(), task.getDescription());
+}
+
+void TaskManager::indexRemove(const Task &task)
+{
+    uint32_t id = static_cast<uint32_t>(task.getId());
+    statusIndex[static_cast<size_t>(task.getStatusCode())].remove(id);
+    priorityIndex[static_cast<size_t>(task.getPriorityCode())].remove(id);
+    stats.remove(task);
+    if (task.hasDueDate())
+        dueIndex.erase(task.getDueDay(), task.getId());
+
+    if (keywordIndexReady)
+        keywordIndex.remove(task.getId(), task.getDescription());
+}
+
+void TaskManager::rebuildIndexes()
+{
+    for (Bitmap &bitmap : statusIndex)
+        bitmap.clear();
+    for (Bitmap &bitmap : priorityIndex)
+        bitmap.clear();
+    stats.clear();
+    keywordIndexReady = false;
+
+    // Bitmaps take IDs in order; the due index is sorted once at the end
+    std::vector<DueIndex::Entry> due;
+    store.forEach([this, &due](const Task &task)
+                  {
+        uint32_t id = static_cast<uint32_t>(task.getId());
+        statusIndex[static_cast<size_t>(task.getStatusCode())].add(id);
+        priorityIndex[static_cast<size_t>(task.getPriorityCode())].add(id);
+        stats.add(task);
+        if (task.hasDueDate())
+        {
+            due.push_back({task.getDueDay(), task.getId()});
+        } });
+    dueIndex.assign(std::move(due));
+}
+
+void TaskManager::loadTasks()
+{
+    if (BinarySnapshot::isSnapshotPath(filename))
     {
-        return FilterUtils::sortById(sorted_tasks, ascending);
+        loadBinarySnapshot();
     }
-    else if (sort_by == "created_date" || sort_by == "created")
+    else
     {
-        return FilterUtils::sortByCreatedDate(sorted_tasks, ascending);
+        loadJSONSnapshot();
     }
 
-    return sorted_tasks;
-}
+    // Mutations made since the last checkpoint
+    replayJournal();
 
-std::vector<Task> TaskManager::getTasksFilteredAndSorted(const std::string &sort_by,
-                                                         bool ascending,
-                                                         const std::string &keyword,
-                                                         const std::string &priority,
-                                                         const std::string &status,
-                                                         const std::string &due_date,
-                                                         bool overdue_only,
-                                                         bool due_today_only) const
-{
-    return FilterUtils::filterAndSort(tasks, sort_by, ascending, keyword, priority,
-                                      status, due_date, overdue_only, due_today_only);
+    // Update nextId to be one higher than the highest existing ID
+    nextId = std::max(nextId, store.maxId() + 1);
+
+    rebuildIndexes();
 }
 
-void TaskManager::loadTasks()
+void TaskManager::loadJSONSnapshot()
 {
     std::ifstream file(filename);
     if (!file.is_open())
@@ -227,37 +631,272 @@ void TaskManager::loadTasks()
                         std::istreambuf_iterator<char>());
     file.close();
 
-    tasks = JSONParser::parseTasksFromJSON(content);
+    snapshotBytes = content.size();
+    std::vector<Task> tasks;
+    if (!JSONParser::parseTasksFromJSON(content, tasks))
+    {
+        loadFailed = true;
+    }
+    store.assign(std::move(tasks));
+}
 
-    // Update nextId to be one higher than the highest existing ID
-    for (const Task &task : tasks)
+void TaskManager::loadBinarySnapshot()
+{
+    MappedSnapshot snapshot;
+    if (!snapshot.open(filename))
     {
-        if (task.getId() >= nextId)
+        // A missing file is a new store; an unreadable one must be kept
+        loadFailed = std::ifstream(filename).good();
+        return;
+    }
+
+    // No text to parse, but still O(n): every record becomes a Task (one
+    // allocation for its description) and loadTasks() rebuilds the indexes.
+    // The mapping is closed once this returns.
+    std::vector<Task> tasks;
+    tasks.reserve(snapshot.count());
+    for (size_t i = 0; i < snapshot.count(); ++i)
+    {
+        if (snapshot.isValid(i))
+            tasks.push_back(snapshot.toTask(i));
+    }
+    // The store drops duplicate IDs, so its size also catches those
+    size_t readable = tasks.size();
+    store.assign(std::move(tasks));
+    if (readable < snapshot.count() || store.size() < readable)
+    {
+        std::cerr << "Warning: " << (snapshot.count() - store.size()) << " damaged or duplicate records in "
+                  << filename << " were skipped." << std::endl;
+        loadFailed = true;
+    }
+
+    nextId = std::max(nextId, snapshot.nextId());
+
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    snapshotBytes = file.is_open() ? static_cast<size_t>(file.tellg()) : 0;
+}
+
+void TaskManager::replayJournal()
+{
+    for (const JournalRecord &record : journal.readAll())
+    {
+        if (record.op == JournalRecord::Op::Put)
+        {
+            store.put(record.task);
+        }
+        else
         {
-            nextId = task.getId() + 1;
+            store.erase(record.id);
         }
     }
 }
 
-void TaskManager::saveTasks() const
+bool TaskManager::saveTasks() const
 {
-    std::ofstream file(filename);
-    if (!file.is_open())
+    std::vector<Task> compacted;
+    const std::vector<Task> &tasks = store.hasTombstones() ? (compacted = store.liveTasks()) : store.rows();
+
+    if (BinarySnapshot::isSnapshotPath(filename))
+    {
+        return BinarySnapshot::write(filename, tasks, nextId);
+    }
+
+    // Replaced via a synced temporary file so a crash leaves either the old
+    // snapshot or the new one, never a half-written or vanished file
+    if (!DurableFile::replace(filename, {JSONParser::tasksToJSON(tasks)}))
     {
         std::cerr << "Error: Cannot save tasks to file " << filename << std::endl;
-        return;
+        return false;
+    }
+    return true;
+}
+
+bool TaskManager::checkpoint()
+{
+    if (!checkWritable())
+    {
+        return false;
+    }
+    store.compact();
+
+    // The journal is the only durable copy until the snapshot is on disk
+    if (!saveTasks())
+    {
+        return false;
+    }
+    if (!journal.truncate())
+    {
+        // Harmless: replaying records the snapshot already holds changes nothing
+        std::cerr << "Warning: Cannot truncate journal " << journal.getPath() << std::endl;
+    }
+
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    snapshotBytes = file.is_open() ? static_cast<size_t>(file.tellg()) : 0;
+    return true;
+}
+
+bool TaskManager::setDeferredJournalSync(bool deferred)
+{
+    return journal.setDeferredSync(deferred);
+}
+
+bool TaskManager::hasUnsyncedChanges() const
+{
+    return journal.hasPending();
+}
+
+bool TaskManager::syncJournal()
+{
+    return journal.sync();
+}
+
+bool TaskManager::exportTasks(const std::string &path) const
+{
+    std::vector<Task> tasks = store.liveTasks();
+
+    if (BinarySnapshot::isSnapshotPath(path))
+    {
+        return BinarySnapshot::write(path, tasks, nextId);
+    }
+
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        std::cerr << "Error: Cannot export tasks to file " << path << std::endl;
+        return false;
     }
 
     file << JSONParser::tasksToJSON(tasks);
-    file.close();
+    return static_cast<bool>(file);
 }
 
-Task *TaskManager::findTaskById(int id)
+int TaskManager::importTasks(const std::string &path)
 {
-    auto it = std::find_if(tasks.begin(), tasks.end(),
-                           [id](const Task &task)
-                           { return task.getId() == id; });
-    return (it != tasks.end()) ? &(*it) : nullptr;
+    if (!checkWritable())
+    {
+        return -1;
+    }
+    std::vector<Task> imported;
+
+    if (BinarySnapshot::isSnapshotPath(path))
+    {
+        MappedSnapshot snapshot;
+        if (!snapshot.open(path))
+        {
+            std::cerr << "Error: Cannot import tasks from file " << path << std::endl;
+            return -1;
+        }
+        for (size_t i = 0; i < snapshot.count(); ++i)
+        {
+            if (!snapshot.isValid(i))
+            {
+                std::cerr << "Error: " << path << " is not a valid task file; nothing was imported." << std::endl;
+                return -1;
+            }
+            imported.push_back(snapshot.toTask(i));
+        }
+    }
+    else
+    {
+        std::ifstream file(path);
+        if (!file.is_open())
+        {
+            std::cerr << "Error: Cannot import tasks from file " << path << std::endl;
+            return -1;
+        }
+        std::string content((std::istreambuf_iterator<char>(file)),
+                            std::istreambuf_iterator<char>());
+        if (!JSONParser::parseTasksFromJSON(content, imported))
+        {
+            std::cerr << "Error: " << path << " is not a valid task file; nothing was imported." << std::endl;
+            return -1;
+        }
+    }
+
+    // Imported tasks get fresh IDs so they never collide with existing ones
+    int firstId = nextId;
+    for (Task &task : imported)
+    {
+        task.setId(generateNextId());
+        store.put(task);
+        indexAdd(task);
+    }
+
+    // One snapshot write instead of a journal record per task. Nothing else
+    // records the imported tasks, so they are taken back out if it fails.
+    if (!checkpoint())
+    {
+        for (const Task &task : imported)
+        {
+            indexRemove(task);
+            store.erase(task.getId());
+        }
+        nextId = firstId;
+        std::cerr << "Error: Cannot save the imported tasks; nothing was imported." << std::endl;
+        return -1;
+    }
+    return static_cast<int>(imported.size());
+}
+
+void TaskManager::applyRecord(const JournalRecord &record)
+{
+    if (const Task *task = store.find(record.id))
+    {
+        indexRemove(*task);
+    }
+
+    // A put replaces in place, so both replicas keep the same insertion order
+    if (record.op == JournalRecord::Op::Put)
+    {
+        store.put(record.task);
+        indexAdd(record.task);
+        nextId = std::max(nextId, record.id + 1);
+    }
+    else
+    {
+        store.erase(record.id);
+    }
+}
+
+void TaskManager::prepareSharedReads()
+{
+    if (!keywordIndexReady)
+        buildKeywordIndex();
+}
+
+void TaskManager::buildKeywordIndex() const
+{
+    keywordIndex.clear();
+    store.forEach([this](const Task &task)
+                  { keywordIndex.add(task.getId(), task.getDescription()); });
+    keywordIndexReady = true;
+}
+
+bool TaskManager::checkWritable() const
+{
+    // Saving over a damaged store would silently drop whatever could not be read
+    if (loadFailed)
+    {
+        std::cerr << "Error: " << filename << " could not be read completely, so it is read-only. "
+                  << "Repair or restore it first." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void TaskManager::maybeCheckpoint()
+{
+    // Folding the journal in once it reaches a quarter of the snapshot keeps the
+    // amortized cost of a mutation constant in the size of the store.
+    if (journal.size() >= std::max(MIN_CHECKPOINT_BYTES, snapshotBytes / 4))
+    {
+        checkpoint();
+    }
+}
+
+const Task *TaskManager::findTaskById(int id) const
+{
+    return store.find(id);
 }
 
 int TaskManager::generateNextId()
@@ -267,5 +906,99 @@ int TaskManager::generateNextId()
 
 size_t TaskManager::getTaskCount() const
 {
-    return tasks.size();
+    return store.size();
+}
+
+size_t TaskManager::countTasksByStatus(TaskStatus status) const
+{
+    return stats.countByStatus(status);
+}
+
+size_t TaskManager::countTasksByPriority(TaskPriority priority) const
+{
+    return stats.countByPriority(priority);
+}
+
+TaskCounts TaskManager::countTasks(const QueryContext &context) const
+{
+    TaskCounts counts;
+    counts.total = stats.getTotal();
+    for (size_t i = 0; i < counts.byStatus.size(); ++i)
+    {
+        counts.byStatus[i] = stats.countByStatus(static_cast<TaskStatus>(i));
+        counts.byPriority[i] = stats.countByPriority(static_cast<TaskPriority>(i));
+    }
+    counts.overdue = dueIndex.countInRange(EARLIEST_DAY, context.today - 1);
+    counts.dueToday = dueIndex.countInRange(context.today, context.today);
+    return counts;
+}
+
+const TaskStats &TaskManager::getStats() const
+{
+    return stats;
+}
+
+bool TaskManager::countFromIndexes(const FilterUtils::TaskPredicate &predicate, size_t &count) const
+{
+    if (!predicate.keyword_lower.empty())
+        return false;
+
+    const Bitmap &statusSet = statusIndex[static_cast<size_t>(predicate.status)];
+    const Bitmap &prioritySet = priorityIndex[static_cast<size_t>(predicate.priority)];
+    int32_t first = 0;
+    int32_t last = 0;
+    if (!dueBounds(predicate, first, last))
+    {
+        if (predicate.check_status && predicate.check_priority)
+            count = stats.countByStatusAndPriority(predicate.status, predicate.priority);
+        else if (predicate.check_status)
+            count = stats.countByStatus(predicate.status);
+        else if (predicate.check_priority)
+            count = stats.countByPriority(predicate.priority);
+        else
+            count = stats.getTotal();
+        return true;
+    }
+
+    // A due range, checked against the bitmaps by ID alone
+    count = 0;
+    for (const DueIndex::Entry &entry : dueIndex.range(first, last))
+    {
+        uint32_t id = static_cast<uint32_t>(entry.id);
+        if ((!predicate.check_status || statusSet.contains(id)) &&
+            (!predicate.check_priority || prioritySet.contains(id)))
+        {
+            count++;
+        }
+    }
+    return true;
+}
+
+size_t TaskManager::countTasksMatching(const FilterUtils::TaskPredicate &predicate) const
+{
+    if (predicate.match_none)
+        return 0;
+
+    size_t count = 0;
+    if (countFromIndexes(predicate, count))
+        return count;
+    return viewTasksMatching(predicate).size();
+}
+
+bool TaskManager::anyTaskMatching(const FilterUtils::TaskPredicate &predicate) const
+{
+    if (predicate.match_none)
+        return false;
+
+    size_t count = 0;
+    if (countFromIndexes(predicate, count))
+        return count > 0;
+
+    TaskView candidates;
+    if (keywordCandidates(predicate.keyword_lower, candidates))
+    {
+        return std::any_of(candidates.begin(), candidates.end(), [&predicate](const Task *task)
+                           { return predicate.matches(*task); });
+    }
+    return !scanColumns(predicate, true).empty();
 }
@@ -1,30 +1,127 @@
 #ifndef TASK_MANAGER_H
 #define TASK_MANAGER_H
 
+#include <array>
 #include <vector>
 #include <string>
 #include "task.h"
+#include "task_store.h"
+#include "journal.h"
+#include "filter_utils.h"
+#include "keyword_index.h"
+#include "bitmap.h"
+#include "due_index.h"
+#include "task_stats.h"
+
+// Counts answered from the indexes without visiting any task
+struct TaskCounts
+{
+    size_t total = 0;
+    std::array<size_t, 3> byStatus{};   // Indexed by TaskStatus
+    std::array<size_t, 3> byPriority{}; // Indexed by TaskPriority
+    size_t overdue = 0;
+    size_t dueToday = 0;
+};
 
 class TaskManager
 {
 private:
-    std::vector<Task> tasks;
+    TaskStore store;
     std::string filename;
     int nextId;
 
+    // Mutations are appended to the journal; the snapshot is only rewritten
+    // when the journal grows past a fraction of the snapshot size.
+    Journal journal;
+    size_t snapshotBytes;
+    bool loadFailed; // The snapshot exists but is damaged; it is never overwritten
+
+    // Task IDs per status and per priority, (due day, ID) pairs in order and
+    // aggregate counters; kept current by every mutation
+    std::array<Bitmap, 3> statusIndex;
+    std::array<Bitmap, 3> priorityIndex;
+    DueIndex dueIndex;
+    TaskStats stats;
+
+    // Built on the second keyword query (a one-off search is cheaper as a
+    // scan) and then kept in step with every mutation.
+    mutable KeywordIndex keywordIndex;
+    mutable bool keywordIndexReady;
+    mutable bool keywordScanned;
+
+    bool keywordCandidates(const std::string &keyword_lower, TaskView &out) const;
+    void buildKeywordIndex() const;
+    void indexAdd(const Task &task);
+    void indexRemove(const Task &task);
+    void rebuildIndexes();
+    TaskView viewOfIds(const std::vector<int> &ids) const;
+    TaskView viewDueRange(int32_t first, int32_t last) const;
+    TaskView scanColumns(const FilterUtils::TaskPredicate &predicate, bool first_only = false) const;
+    bool countFromIndexes(const FilterUtils::TaskPredicate &predicate, size_t &count) const;
+    size_t selectionCount(const FilterUtils::TaskPredicate &predicate) const;
+
+    void loadJSONSnapshot();
+    void loadBinarySnapshot();
+    void replayJournal();
+    void maybeCheckpoint();
+    bool checkWritable() const;
+
 public:
     // Constructor
     explicit TaskManager(const std::string &filename = "tasks.json");
 
-    // Enhanced CRUD operations
-    void addTask(const std::string &description, const std::string &priority = "medium",
-                 const std::string &due_date = "");
+    // Enhanced CRUD operations. addTask returns the new ID, or 0 if rejected.
+    int addTask(const std::string &description, const std::string &priority = "medium",
+                const std::string &due_date = "");
     bool updateTask(int id, const std::string &description = "",
                     const std::string &status = "", const std::string &priority = "",
                     const std::string &due_date = "");
     bool deleteTask(int id);
 
-    // Basic listing operations
+    // Zero-copy queries. Views point into the store, keep insertion order and
+    // stay valid until the next add/update/delete. Date-relative queries take
+    // the caller's QueryContext; the copying getters below capture their own.
+    TaskView viewAllTasks() const;
+    TaskView viewTasksByStatus(const std::string &status) const;
+    TaskView viewTasksByPriority(const std::string &priority) const;
+    TaskView viewTasksByKeyword(const std::string &keyword) const;
+    TaskView viewTasksDueBy(const std::string &date) const;
+    TaskView viewTasksDueBetween(const std::string &start_date, const std::string &end_date) const;
+    TaskView viewOverdueTasks(const QueryContext &context) const;
+    TaskView viewTasksDueToday(const QueryContext &context) const;
+    TaskView viewTasksSorted(const std::string &sort_by = "id", bool ascending = true) const;
+    TaskView viewTasksFilteredAndSorted(const QueryContext &context,
+                                        const std::string &sort_by = "",
+                                        bool ascending = true,
+                                        const std::string &keyword = "",
+                                        const std::string &priority = "",
+                                        const std::string &status = "",
+                                        const std::string &due_date = "",
+                                        bool overdue_only = false,
+                                        bool due_today_only = false) const;
+    TaskView viewTasksMatching(const FilterUtils::TaskPredicate &predicate) const;
+
+    // True if viewTasksMatching answers a keyword-free predicate with the
+    // column kernel rather than by walking index candidates (the smallest
+    // candidate set covers too many of the slots, or no index applies)
+    bool prefersColumnScan(const FilterUtils::TaskPredicate &predicate) const;
+
+    // One page of the matching tasks in key order. Sorting stops at the page;
+    // due-date order with a limit walks the due index instead. Returns false
+    // if the page's cursor does not match the keys.
+    bool viewTasksPage(const FilterUtils::TaskPredicate &predicate,
+                       const std::vector<FilterUtils::SortKey> &keys,
+                       const FilterUtils::PageRequest &page,
+                       FilterUtils::TaskPage &out) const;
+
+    // Visits every task in insertion order without building a list
+    template <typename Visitor>
+    void forEachTask(Visitor &&visit) const
+    {
+        store.forEach(visit);
+    }
+
+    // Basic listing operations (copying)
     std::vector<Task> getAllTasks() const;
     std::vector<Task> getTasksByStatus(const std::string &status) const;
     std::vector<Task> getTasksByPriority(const std::string &priority) const;
@@ -55,12 +152,37 @@ public:
 
     // File operations
     void loadTasks();
-    void saveTasks() const;
+    bool saveTasks() const;  // Durable (fsync'ed) before returning true
+    bool checkpoint();       // Truncates the journal only once the snapshot is durable
+
+    // Group commit: with deferred sync, mutations are journaled in memory
+    // and syncJournal() makes all of them durable with one fsync
+    bool setDeferredJournalSync(bool deferred); // False if turning it off failed to sync
+    bool hasUnsyncedChanges() const;
+    bool syncJournal();
+
+    // Applies a mutation made elsewhere (no journal write, no output); keeps a
+    // replica in step with the TaskManager that made it
+    void applyRecord(const JournalRecord &record);
+
+    // Builds the lazy keyword index now, after which const queries never
+    // modify the manager and may run on several threads at once
+    void prepareSharedReads();
+
+    // Import/export (format chosen by extension: .bin = binary snapshot, otherwise JSON)
+    bool exportTasks(const std::string &path) const;
+    int importTasks(const std::string &path);
 
     // Utility
-    Task *findTaskById(int id);
+    const Task *findTaskById(int id) const;
     int generateNextId();
     size_t getTaskCount() const;
+    size_t countTasksByStatus(TaskStatus status) const;
+    size_t countTasksByPriority(TaskPriority priority) const;
+    TaskCounts countTasks(const QueryContext &context) const;
+    const TaskStats &getStats() const;
+    size_t countTasksMatching(const FilterUtils::TaskPredicate &predicate) const;
+    bool anyTaskMatching(const FilterUtils::TaskPredicate &predicate) const; // Stops at the first match
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "task_stats.h"
+
+void TaskStats::add(const Task &task)
+{
+    size_t status = static_cast<size_t>(task.getStatusCode());
+    size_t priority = static_cast<size_t>(task.getPriorityCode());
+
+    total++;
+    byStatus[status]++;
+    byPriority[priority]++;
+    byStatusPriority[status][priority]++;
+
+    if (!task.hasDueDate())
+    {
+        undated++;
+        return;
+    }
+    WeekCounts &week = dueWeeks[weekStart(task.getDueDay())];
+    week.total++;
+    week.byStatus[status]++;
+}
+
+void TaskStats::remove(const Task &task)
+{
+    size_t status = static_cast<size_t>(task.getStatusCode());
+    size_t priority = static_cast<size_t>(task.getPriorityCode());
+
+    total--;
+    byStatus[status]--;
+    byPriority[priority]--;
+    byStatusPriority[status][priority]--;
+
+    if (!task.hasDueDate())
+    {
+        undated--;
+        return;
+    }
+    auto it = dueWeeks.find(weekStart(task.getDueDay()));
+    if (it == dueWeeks.end())
+        return;
+    it->second.total--;
+    it->second.byStatus[status]--;
+    if (it->second.total == 0)
+        dueWeeks.erase(it);
+}
+
+void TaskStats::clear()
+{
+    *this = TaskStats();
+}
+
+size_t TaskStats::countByStatus(TaskStatus status) const
+{
+    return byStatus[static_cast<size_t>(status)];
+}
+
+size_t TaskStats::countByPriority(TaskPriority priority) const
+{
+    return byPriority[static_cast<size_t>(priority)];
+}
+
+size_t TaskStats::countByStatusAndPriority(TaskStatus status, TaskPriority priority) const
+{
+    return byStatusPriority[static_cast<size_t>(status)][static_cast<size_t>(priority)];
+}
+
+int32_t TaskStats::weekStart(int32_t day)
+{
+    // Day 0 (1970-01-01) was a Thursday, three days after a Monday
+    int32_t sinceMonday = ((day % 7) + 7 + 3) % 7;
+    return day - sinceMonday;
+}
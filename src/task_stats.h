@@ -0,0 +1,48 @@
+#ifndef TASK_STATS_H
+#define TASK_STATS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include "task.h"
+
+// Aggregate counters kept in step with every mutation.
+//
+// Adding or removing a task applies its delta to each aggregate (an update
+// is a remove of the old state plus an add of the new), so reading any
+// aggregate costs the same however many tasks there are. Due weeks start on
+// Monday and are keyed by that Monday's day number.
+class TaskStats
+{
+public:
+    struct WeekCounts
+    {
+        size_t total = 0;
+        std::array<size_t, 3> byStatus{}; // Indexed by TaskStatus
+    };
+
+private:
+    size_t total = 0;
+    std::array<std::array<size_t, 3>, 3> byStatusPriority{}; // [status][priority]
+    std::array<size_t, 3> byStatus{};
+    std::array<size_t, 3> byPriority{};
+    size_t undated = 0;
+    std::map<int32_t, WeekCounts> dueWeeks; // Weeks with no tasks are dropped
+
+public:
+    void add(const Task &task);
+    void remove(const Task &task);
+    void clear();
+
+    size_t getTotal() const { return total; }
+    size_t countByStatus(TaskStatus status) const;
+    size_t countByPriority(TaskPriority priority) const;
+    size_t countByStatusAndPriority(TaskStatus status, TaskPriority priority) const;
+    size_t countUndated() const { return undated; }
+    const std::map<int32_t, WeekCounts> &getDueWeeks() const { return dueWeeks; }
+
+    static int32_t weekStart(int32_t day); // Monday on or before day
+};
+
+#endif
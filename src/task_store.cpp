@@ -0,0 +1,283 @@
+#include "task_store.h"
+#include <algorithm>
+#include <cctype>
+
+namespace
+{
+    // Compaction is skipped for small stores; the table is cheap to scan
+    const size_t MIN_TOMBSTONES_FOR_COMPACTION = 64;
+
+    // IDs further than this past the live count go to the sparse map
+    const size_t DENSE_SLACK = 1 << 16;
+
+    // Replaced and deleted descriptions are reclaimed once they outweigh the live text
+    const size_t MIN_STALE_TEXT_FOR_REBUILD = 1 << 20;
+}
+
+TaskStore::TaskStore() : tombstones(0), staleTextBytes(0) {}
+
+void TaskStore::writeColumns(size_t slot, const Task &task)
+{
+    if (slot == idColumn.size())
+    {
+        idColumn.push_back(0);
+        statusColumn.push_back(TaskStatus::Pending);
+        priorityColumn.push_back(TaskPriority::Medium);
+        dueColumn.push_back(0);
+        createdColumn.push_back(0);
+        descriptionOffsets.push_back(0);
+        descriptionLengths.push_back(0);
+    }
+    else
+    {
+        staleTextBytes += descriptionLengths[slot];
+    }
+
+    idColumn[slot] = task.getId();
+    statusColumn[slot] = task.getStatusCode();
+    priorityColumn[slot] = task.getPriorityCode();
+    dueColumn[slot] = task.getDueDay();
+    createdColumn[slot] = task.getCreatedDay();
+
+    const std::string &description = task.getDescription();
+    descriptionOffsets[slot] = descriptionText.size();
+    descriptionLengths[slot] = static_cast<uint32_t>(description.size());
+    for (char c : description)
+    {
+        descriptionText.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+}
+
+void TaskStore::reclaimStaleText()
+{
+    if (staleTextBytes >= MIN_STALE_TEXT_FOR_REBUILD && staleTextBytes * 2 >= descriptionText.size())
+    {
+        rebuildColumns();
+    }
+}
+
+void TaskStore::rebuildColumns()
+{
+    idColumn.clear();
+    statusColumn.clear();
+    priorityColumn.clear();
+    dueColumn.clear();
+    createdColumn.clear();
+    descriptionOffsets.clear();
+    descriptionLengths.clear();
+    descriptionText.clear();
+    staleTextBytes = 0;
+
+    for (size_t slot = 0; slot < slots.size(); ++slot)
+    {
+        writeColumns(slot, slots[slot]);
+    }
+}
+
+bool TaskStore::isDense(int id) const
+{
+    return id > 0 && static_cast<size_t>(id) < slots.size() * 2 + DENSE_SLACK;
+}
+
+int32_t TaskStore::slotOf(int id) const
+{
+    if (id <= 0)
+        return NO_SLOT;
+
+    if (static_cast<size_t>(id) < slotById.size() && slotById[static_cast<size_t>(id)] != NO_SLOT)
+        return slotById[static_cast<size_t>(id)];
+
+    if (sparseSlotById.empty())
+        return NO_SLOT;
+
+    auto it = sparseSlotById.find(id);
+    return it != sparseSlotById.end() ? it->second : NO_SLOT;
+}
+
+void TaskStore::setSlot(int id, int32_t slot)
+{
+    if (isDense(id) || static_cast<size_t>(id) < slotById.size())
+    {
+        if (static_cast<size_t>(id) >= slotById.size())
+        {
+            slotById.resize(std::max(static_cast<size_t>(id) + 1, slotById.size() * 2), NO_SLOT);
+        }
+        slotById[static_cast<size_t>(id)] = slot;
+        sparseSlotById.erase(id);
+    }
+    else if (slot == NO_SLOT)
+    {
+        sparseSlotById.erase(id);
+    }
+    else
+    {
+        sparseSlotById[id] = slot;
+    }
+}
+
+const Task *TaskStore::find(int id) const
+{
+    int32_t slot = slotOf(id);
+    return slot == NO_SLOT ? nullptr : &slots[static_cast<size_t>(slot)];
+}
+
+bool TaskStore::contains(int id) const
+{
+    return slotOf(id) != NO_SLOT;
+}
+
+void TaskStore::put(const Task &task)
+{
+    if (task.getId() <= 0)
+        return;
+
+    int32_t slot = slotOf(task.getId());
+    if (slot != NO_SLOT)
+    {
+        slots[static_cast<size_t>(slot)] = task;
+        writeColumns(static_cast<size_t>(slot), task);
+        reclaimStaleText();
+        return;
+    }
+
+    setSlot(task.getId(), static_cast<int32_t>(slots.size()));
+    slots.push_back(task);
+    writeColumns(slots.size() - 1, task);
+}
+
+bool TaskStore::erase(int id)
+{
+    int32_t slot = slotOf(id);
+    if (slot == NO_SLOT)
+        return false;
+
+    // Tombstone the slot instead of shifting every later element
+    slots[static_cast<size_t>(slot)] = Task(0, std::string(), TaskStatus::Pending, TaskPriority::Medium, 0, 0);
+    idColumn[static_cast<size_t>(slot)] = 0;
+    staleTextBytes += descriptionLengths[static_cast<size_t>(slot)];
+    descriptionLengths[static_cast<size_t>(slot)] = 0;
+    setSlot(id, NO_SLOT);
+    tombstones++;
+
+    if (tombstones >= MIN_TOMBSTONES_FOR_COMPACTION && tombstones * 2 >= slots.size())
+    {
+        compact();
+    }
+    else
+    {
+        reclaimStaleText();
+    }
+    return true;
+}
+
+void TaskStore::assign(std::vector<Task> tasks)
+{
+    clear();
+    slots.reserve(tasks.size());
+    for (Task &task : tasks)
+    {
+        if (task.getId() > 0 && !contains(task.getId()))
+        {
+            setSlot(task.getId(), static_cast<int32_t>(slots.size()));
+            slots.push_back(std::move(task));
+        }
+    }
+    rebuildColumns();
+}
+
+void TaskStore::clear()
+{
+    slots.clear();
+    slotById.clear();
+    sparseSlotById.clear();
+    tombstones = 0;
+    rebuildColumns();
+}
+
+void TaskStore::compact()
+{
+    if (tombstones == 0)
+        return;
+
+    size_t write = 0;
+    for (size_t read = 0; read < slots.size(); ++read)
+    {
+        if (slots[read].getId() == 0)
+            continue;
+
+        if (write != read)
+        {
+            slots[write] = std::move(slots[read]);
+        }
+        setSlot(slots[write].getId(), static_cast<int32_t>(write));
+        write++;
+    }
+
+    slots.resize(write);
+    tombstones = 0;
+    rebuildColumns();
+}
+
+size_t TaskStore::size() const
+{
+    return slots.size() - tombstones;
+}
+
+bool TaskStore::hasTombstones() const
+{
+    return tombstones > 0;
+}
+
+const std::vector<Task> &TaskStore::rows() const
+{
+    return slots;
+}
+
+std::vector<Task> TaskStore::liveTasks() const
+{
+    if (tombstones == 0)
+        return slots;
+
+    std::vector<Task> live;
+    live.reserve(size());
+    for (const Task &task : slots)
+    {
+        if (task.getId() != 0)
+            live.push_back(task);
+    }
+    return live;
+}
+
+TaskView TaskStore::view() const
+{
+    TaskView live;
+    live.reserve(size());
+    forEach([&live](const Task &task)
+            { live.push_back(&task); });
+    return live;
+}
+
+TaskStore::Columns TaskStore::columns() const
+{
+    return Columns{idColumn, statusColumn, priorityColumn, dueColumn, createdColumn};
+}
+
+std::string_view TaskStore::descriptionLower(size_t slot) const
+{
+    return std::string_view(descriptionText).substr(descriptionOffsets[slot], descriptionLengths[slot]);
+}
+
+size_t TaskStore::descriptionTextBytes() const
+{
+    return descriptionText.size();
+}
+
+int TaskStore::maxId() const
+{
+    int maxId = 0;
+    for (const Task &task : slots)
+    {
+        maxId = std::max(maxId, task.getId());
+    }
+    return maxId;
+}
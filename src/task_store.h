@@ -0,0 +1,106 @@
+#ifndef TASK_STORE_H
+#define TASK_STORE_H
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "task.h"
+
+// Row storage for tasks with O(1) lookup by ID.
+//
+// IDs come from a counter, so the id -> slot index is a dense table (with a
+// hash map for the rare far-out-of-range ID from a hand-edited file).
+// Deleting a task only tombstones its slot; slots are compacted once
+// tombstones make up half the table, which keeps insertion order and makes
+// deletion amortized O(1).
+//
+// Each slot's fixed-width fields are mirrored in column arrays, and its
+// description is kept lowercased in one contiguous buffer. Filter scans
+// read only the columns they test rather than pulling whole Task objects
+// (and their string headers) through the cache.
+//
+// The columns are a mirror, not a replacement: the Task rows stay, so every
+// slot costs 26 bytes of columns on top of its 48-byte Task, and every
+// description is held twice (once in the Task, once lowercased). Lookups
+// and returned views still go through the rows.
+class TaskStore
+{
+public:
+    // One entry per slot, in slot order; tombstones have ID 0
+    struct Columns
+    {
+        std::span<const int32_t> id;
+        std::span<const TaskStatus> status;
+        std::span<const TaskPriority> priority;
+        std::span<const int32_t> dueDay;
+        std::span<const int32_t> createdDay;
+    };
+
+private:
+    static constexpr int32_t NO_SLOT = -1;
+
+    std::vector<Task> slots;          // Tombstoned slots hold a Task with ID 0
+    std::vector<int32_t> slotById;    // Dense id -> slot
+    std::unordered_map<int, int32_t> sparseSlotById;
+    size_t tombstones;
+
+    std::vector<int32_t> idColumn;
+    std::vector<TaskStatus> statusColumn;
+    std::vector<TaskPriority> priorityColumn;
+    std::vector<int32_t> dueColumn;
+    std::vector<int32_t> createdColumn;
+    std::vector<uint64_t> descriptionOffsets;
+    std::vector<uint32_t> descriptionLengths;
+    std::string descriptionText; // Lowercased descriptions back to back
+    size_t staleTextBytes;       // Text left behind by replaced or deleted descriptions
+
+    void writeColumns(size_t slot, const Task &task);
+    void rebuildColumns();
+    void reclaimStaleText();
+
+    int32_t slotOf(int id) const;
+    void setSlot(int id, int32_t slot);
+    bool isDense(int id) const;
+
+public:
+    TaskStore();
+
+    // Lookup (pointers stay valid until the next mutation). Tasks are
+    // changed through put() so the columns stay in step.
+    const Task *find(int id) const;
+    bool contains(int id) const;
+
+    // Mutation
+    void put(const Task &task); // Insert, or replace the task with the same ID
+    bool erase(int id);
+    void assign(std::vector<Task> tasks);
+    void clear();
+    void compact();
+
+    // Iteration
+    size_t size() const; // Live tasks
+    bool hasTombstones() const;
+    const std::vector<Task> &rows() const; // Includes tombstones (ID 0)
+    std::vector<Task> liveTasks() const;   // Copy in insertion order
+    TaskView view() const;                 // Live tasks in insertion order, no copies
+    Columns columns() const;               // Parallel to rows()
+    std::string_view descriptionLower(size_t slot) const;
+    size_t descriptionTextBytes() const; // Lowercased text, stale copies included
+
+    // Visits live tasks in insertion order; the store must not be mutated meanwhile
+    template <typename Visitor>
+    void forEach(Visitor &&visit) const
+    {
+        for (const Task &task : slots)
+        {
+            if (task.getId() != 0)
+                visit(task);
+        }
+    }
+    int maxId() const;
+};
+
+#endif
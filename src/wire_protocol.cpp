@@ -0,0 +1,196 @@
+#include "wire_protocol.h"
+#include <algorithm>
+#include <cerrno>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace WireProtocol
+{
+    namespace
+    {
+        void appendLength(std::string &out, size_t length)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                out.push_back(static_cast<char>((length >> (8 * i)) & 0xFF));
+            }
+        }
+
+        uint32_t loadLength(const char *bytes)
+        {
+            uint32_t length = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                length |= static_cast<uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+            }
+            return length;
+        }
+
+        void appendString(std::string &out, std::string_view value)
+        {
+            appendLength(out, value.size());
+            out.append(value);
+        }
+
+        bool readLength(std::string_view payload, size_t &offset, uint32_t &length)
+        {
+            if (payload.size() - offset < HEADER_BYTES)
+                return false;
+            length = loadLength(payload.data() + offset);
+            offset += HEADER_BYTES;
+            return true;
+        }
+
+        bool readString(std::string_view payload, size_t &offset, std::string &value)
+        {
+            uint32_t length = 0;
+            if (!readLength(payload, offset, length) || payload.size() - offset < length)
+                return false;
+            value.assign(payload.substr(offset, length));
+            offset += length;
+            return true;
+        }
+
+        // Frames are built in place: reserve the header, append, then patch it
+        void patchLength(std::string &frames, size_t start)
+        {
+            size_t length = frames.size() - start - HEADER_BYTES;
+            for (int i = 0; i < 4; ++i)
+            {
+                frames[start + static_cast<size_t>(i)] = static_cast<char>((length >> (8 * i)) & 0xFF);
+            }
+        }
+
+        void finishFrame(std::string &frame)
+        {
+            patchLength(frame, 0);
+        }
+    }
+
+    std::string encodeRequest(const std::vector<std::string> &args)
+    {
+        std::string frame(HEADER_BYTES, '\0');
+        appendLength(frame, args.size());
+        for (const std::string &arg : args)
+        {
+            appendString(frame, arg);
+        }
+        finishFrame(frame);
+        return frame;
+    }
+
+    bool decodeRequest(std::string_view payload, std::vector<std::string> &args)
+    {
+        args.clear();
+        size_t offset = 0;
+        uint32_t count = 0;
+        if (!readLength(payload, offset, count) || count > payload.size() / HEADER_BYTES)
+            return false;
+
+        args.resize(count);
+        for (std::string &arg : args)
+        {
+            if (!readString(payload, offset, arg))
+                return false;
+        }
+        return offset == payload.size();
+    }
+
+    std::string encodeResponse(std::string_view out, std::string_view err)
+    {
+        size_t parts = std::max<size_t>(1, (out.size() + err.size() + RESPONSE_PART_BYTES - 1) / RESPONSE_PART_BYTES);
+        std::string frames;
+        frames.reserve(parts * HEADER_BYTES * 4 + out.size() + err.size());
+
+        // stdout first, then stderr, at most RESPONSE_PART_BYTES per frame
+        do
+        {
+            size_t outPiece = std::min(out.size(), RESPONSE_PART_BYTES);
+            size_t errPiece = std::min(err.size(), RESPONSE_PART_BYTES - outPiece);
+            size_t start = frames.size();
+            frames.append(HEADER_BYTES, '\0');
+            appendString(frames, out.substr(0, outPiece));
+            appendString(frames, err.substr(0, errPiece));
+            out.remove_prefix(outPiece);
+            err.remove_prefix(errPiece);
+            appendLength(frames, (out.empty() && err.empty()) ? 0 : 1);
+            patchLength(frames, start);
+        } while (!out.empty() || !err.empty());
+        return frames;
+    }
+
+    bool decodeResponse(std::string_view payload, std::string &out, std::string &err, bool &more)
+    {
+        size_t offset = 0;
+        uint32_t flag = 0;
+        if (!readString(payload, offset, out) || !readString(payload, offset, err) ||
+            !readLength(payload, offset, flag) || flag > 1)
+            return false;
+        more = flag == 1;
+        return offset == payload.size();
+    }
+
+    FrameStatus takeFrame(std::string_view buffer, size_t &offset, std::string_view &payload)
+    {
+        if (buffer.size() - offset < HEADER_BYTES)
+            return FrameStatus::Incomplete;
+
+        uint32_t length = loadLength(buffer.data() + offset);
+        if (length > MAX_FRAME_BYTES)
+            return FrameStatus::Invalid;
+        if (buffer.size() - offset - HEADER_BYTES < length)
+            return FrameStatus::Incomplete;
+
+        payload = buffer.substr(offset + HEADER_BYTES, length);
+        offset += HEADER_BYTES + length;
+        return FrameStatus::Complete;
+    }
+
+    bool writeAll(int fd, std::string_view data)
+    {
+        size_t written = 0;
+        while (written < data.size())
+        {
+            // MSG_NOSIGNAL: a peer that hung up is an error, not a SIGPIPE
+            ssize_t n = ::send(fd, data.data() + written, data.size() - written, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            written += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    bool readFrame(int fd, std::string &payload)
+    {
+        std::string buffer;
+        return readFrame(fd, payload, buffer);
+    }
+
+    bool readFrame(int fd, std::string &payload, std::string &buffer)
+    {
+        char chunk[65536];
+        while (true)
+        {
+            size_t offset = 0;
+            std::string_view frame;
+            FrameStatus status = takeFrame(buffer, offset, frame);
+            if (status == FrameStatus::Complete)
+            {
+                payload.assign(frame);
+                buffer.erase(0, offset);
+                return true;
+            }
+            if (status == FrameStatus::Invalid)
+                return false;
+
+            ssize_t n = ::read(fd, chunk, sizeof(chunk));
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                return false;
+            buffer.append(chunk, static_cast<size_t>(n));
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef WIRE_PROTOCOL_H
+#define WIRE_PROTOCOL_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Framing between the CLI and a daemon (see server.h).
+//
+// Every message is a frame: a 4-byte little-endian payload length followed
+// by the payload. Strings inside a payload are length-prefixed the same way.
+//   request:  argc, then each argument
+//   response: one or more parts, each a frame holding a piece of stdout, a
+//             piece of stderr and a flag (1 = another part follows)
+// Splitting responses keeps every frame far below MAX_FRAME_BYTES however
+// much a command prints.
+namespace WireProtocol
+{
+    const size_t HEADER_BYTES = 4;
+    const size_t MAX_FRAME_BYTES = 64u << 20; // Larger lengths mean a corrupt stream
+    const size_t RESPONSE_PART_BYTES = 1u << 20; // Output carried per response frame
+
+    enum class FrameStatus
+    {
+        Complete,
+        Incomplete,
+        Invalid
+    };
+
+    std::string encodeRequest(const std::vector<std::string> &args);   // Whole frame
+    bool decodeRequest(std::string_view payload, std::vector<std::string> &args);
+    std::string encodeResponse(std::string_view out, std::string_view err); // All of its frames
+    // Decodes one part; more is set while further parts of the response follow
+    bool decodeResponse(std::string_view payload, std::string &out, std::string &err, bool &more);
+
+    // Looks for one frame at the start of buffer[offset...]. On Complete,
+    // payload views into buffer and offset moves past the frame.
+    FrameStatus takeFrame(std::string_view buffer, size_t &offset, std::string_view &payload);
+
+    // Blocking socket helpers for simple clients; false on I/O error or EOF
+    bool writeAll(int fd, std::string_view data);
+    bool readFrame(int fd, std::string &payload);
+    // For several replies in a row: bytes read past the frame stay in buffer
+    bool readFrame(int fd, std::string &payload, std::string &buffer);
+}
+
+#endif
@@ -0,0 +1,90 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/batch_mode.h"
+
+const std::string TEST_FILE = "test_batch_tasks.json";
+
+void removeTestFiles()
+{
+    std::remove(TEST_FILE.c_str());
+    std::remove((TEST_FILE + ".journal").c_str());
+}
+
+void testNextCommand() {
+    std::cout << "Testing script parsing..." << std::endl;
+    
+    std::istringstream script("# comment\n"
+                              "\n"
+                              "   \t\n"
+                              "add \"Buy milk\" --priority high\r\n"
+                              "  commit\n"
+                              "list");
+    std::vector<std::string> args;
+    size_t line = 0;
+    
+    assert(BatchMode::nextCommand(script, args, line));
+    assert(line == 4);
+    assert((args == std::vector<std::string>{"add", "Buy milk", "--priority", "high"}));
+    
+    assert(BatchMode::nextCommand(script, args, line));
+    assert(line == 5 && BatchMode::isCommitCommand(args));
+    
+    assert(BatchMode::nextCommand(script, args, line));
+    assert(line == 6 && args.size() == 1 && args[0] == "list");
+    assert(!BatchMode::nextCommand(script, args, line));
+    
+    assert(!BatchMode::isAllowed({"batch", "other.txt"}, 1));
+    assert(BatchMode::isAllowed({"add", "x"}, 1));
+    
+    std::cout << "✓ Script parsing tests passed!" << std::endl;
+}
+
+void testRun() {
+    std::cout << "Testing batch runs..." << std::endl;
+    
+    removeTestFiles();
+    std::ostringstream sink;
+    std::streambuf *savedOut = std::cout.rdbuf(sink.rdbuf());
+    std::streambuf *savedErr = std::cerr.rdbuf(sink.rdbuf());
+    
+    {
+        TaskManager manager(TEST_FILE);
+        BatchMode batch(manager);
+        std::istringstream script("add \"First\"\n"
+                                  "add \"Second\" -p high\n"
+                                  "commit\n"
+                                  "done 1\n"
+                                  "interactive\n"
+                                  "delete 2\n");
+        assert(batch.run(script));
+        assert(manager.getTaskCount() == 1);
+        assert(!manager.hasUnsyncedChanges());
+    }
+    
+    // Everything was journaled by the end of the run
+    TaskManager reloaded(TEST_FILE);
+    assert(reloaded.getTaskCount() == 1);
+    assert(reloaded.findTaskById(1)->getStatus() == "done");
+    
+    std::cout.rdbuf(savedOut);
+    std::cerr.rdbuf(savedErr);
+    assert(sink.str().find("'interactive' cannot run inside a batch") != std::string::npos);
+    assert(sink.str().find("Batch finished: 4 commands.") != std::string::npos);
+    removeTestFiles();
+    
+    std::cout << "✓ Batch run tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running BatchMode unit tests...\n" << std::endl;
+    
+    testNextCommand();
+    testRun();
+    
+    std::cout << "\n✓ All BatchMode tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <iostream>
+#include <cassert>
+#include <set>
+#include <vector>
+#include "../src/bitmap.h"
+
+void testAddRemove()
+{
+    std::cout << "Testing bitmap add/remove..." << std::endl;
+
+    Bitmap bitmap;
+    assert(bitmap.empty());
+    assert(bitmap.add(5));
+    assert(!bitmap.add(5));
+    assert(bitmap.add(70000)); // Second chunk
+    assert(bitmap.add(3));
+    assert(bitmap.contains(5) && bitmap.contains(70000) && bitmap.contains(3));
+    assert(!bitmap.contains(4));
+    assert(bitmap.cardinality() == 3);
+
+    std::vector<uint32_t> values;
+    bitmap.forEach([&values](uint32_t value)
+                   { values.push_back(value); });
+    assert((values == std::vector<uint32_t>{3, 5, 70000}));
+
+    assert(bitmap.remove(70000));
+    assert(!bitmap.remove(70000));
+    assert(bitmap.cardinality() == 2);
+
+    std::cout << "✓ Bitmap add/remove tests passed!" << std::endl;
+}
+
+void testDenseChunks()
+{
+    std::cout << "Testing dense bitmap chunks..." << std::endl;
+
+    // Past 4096 values a chunk switches to a bitset, and back when it empties out
+    Bitmap bitmap;
+    for (uint32_t i = 1; i <= 10000; ++i)
+        bitmap.add(i);
+    assert(bitmap.cardinality() == 10000);
+    assert(bitmap.contains(9999));
+
+    for (uint32_t i = 1; i <= 9000; ++i)
+        bitmap.remove(i);
+    assert(bitmap.cardinality() == 1000);
+    assert(!bitmap.contains(9000) && bitmap.contains(9001));
+
+    std::cout << "✓ Dense chunk tests passed!" << std::endl;
+}
+
+void testSetOperations()
+{
+    std::cout << "Testing bitmap AND/OR..." << std::endl;
+
+    Bitmap evens, threes;
+    std::set<uint32_t> both, either;
+    for (uint32_t i = 0; i < 200000; i += 2)
+    {
+        evens.add(i);
+        either.insert(i);
+    }
+    for (uint32_t i = 0; i < 200000; i += 3)
+    {
+        threes.add(i);
+        either.insert(i);
+        if (i % 2 == 0)
+            both.insert(i);
+    }
+
+    Bitmap intersection = evens & threes;
+    Bitmap unionSet = evens | threes;
+    assert(intersection.cardinality() == both.size());
+    assert(unionSet.cardinality() == either.size());
+
+    std::vector<uint32_t> values;
+    intersection.forEach([&values](uint32_t value)
+                         { values.push_back(value); });
+    assert(std::vector<uint32_t>(both.begin(), both.end()) == values);
+
+    Bitmap sparse;
+    sparse.add(6);
+    sparse.add(7);
+    assert((sparse & evens).cardinality() == 1);
+    assert((sparse | evens).cardinality() == evens.cardinality() + 1);
+
+    std::cout << "✓ Bitmap set operation tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Bitmap unit tests...\n" << std::endl;
+    
+    testAddRemove();
+    testDenseChunks();
+    testSetOperations();
+    
+    std::cout << "\n✓ All Bitmap tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include "../src/column_filter.h"
+#include "../src/date_utils.h"
+
+// Both kernels must agree with TaskPredicate::matchesFields slot by slot
+void checkKernels(const TaskStore &store, const FilterUtils::TaskPredicate &predicate, size_t begin, size_t end)
+{
+    TaskStore::Columns columns = store.columns();
+    ColumnFilter::FieldPredicate fields = ColumnFilter::lower(predicate);
+    std::vector<uint64_t> scalar((end - begin + 63) / 64 + 1, ~0ULL);
+    std::vector<uint64_t> simd(scalar.size(), ~0ULL);
+    
+    ColumnFilter::selectScalar(fields, columns, begin, end, scalar.data());
+    if (ColumnFilter::hasAvx2()) {
+        ColumnFilter::selectAvx2(fields, columns, begin, end, simd.data());
+    } else {
+        ColumnFilter::select(fields, columns, begin, end, simd.data());
+    }
+    
+    for (size_t slot = begin; slot < end; ++slot) {
+        size_t bit = slot - begin;
+        bool expected = columns.id[slot] != 0 &&
+                        predicate.matchesFields(columns.status[slot], columns.priority[slot], columns.dueDay[slot]);
+        assert(((scalar[bit / 64] >> (bit % 64)) & 1) == expected);
+        assert(((simd[bit / 64] >> (bit % 64)) & 1) == expected);
+    }
+    
+    // Bits past the end stay clear
+    size_t words = (end - begin + 63) / 64;
+    if ((end - begin) % 64 != 0) {
+        assert((scalar[words - 1] >> ((end - begin) % 64)) == 0);
+        assert((simd[words - 1] >> ((end - begin) % 64)) == 0);
+    }
+    assert(scalar[words] == ~0ULL && simd[words] == ~0ULL);
+}
+
+void testKernels() {
+    std::cout << "Testing column kernels (" << ColumnFilter::kernelName() << ")..." << std::endl;
+    
+    int32_t today = DateUtils::toDayNumber(2025, 6, 15);
+    TaskStore store;
+    uint32_t seed = 7;
+    for (int id = 1; id <= 1000; ++id) {
+        seed = seed * 1103515245u + 12345u;
+        int32_t due = (seed >> 8) % 5 == 0 ? DateUtils::NO_DATE : today - 20 + static_cast<int32_t>((seed >> 12) % 40);
+        store.put(Task(id, "Task", static_cast<TaskStatus>((seed >> 4) % 3),
+                       static_cast<TaskPriority>((seed >> 6) % 3), due, today));
+    }
+    for (int id = 50; id <= 1000; id += 7) {
+        store.erase(id); // Tombstones must never be selected
+    }
+    
+    QueryContext context{today};
+    std::vector<FilterUtils::TaskPredicate> predicates = {
+        FilterUtils::compileCriteria(context),
+        FilterUtils::compileCriteria(context, "", "high"),
+        FilterUtils::compileCriteria(context, "", "", "pending"),
+        FilterUtils::compileCriteria(context, "", "low", "done", "", true),
+        FilterUtils::compileCriteria(context, "", "", "", "", false, true),
+        FilterUtils::compileCriteria(context, "", "", "", "2025-06-01"),
+        FilterUtils::compileCriteria(context, "", "", "", "", true, true), // Empty range
+        FilterUtils::compileCriteria(context, "", "urgent"),
+    };
+    
+    size_t slots = store.rows().size();
+    for (const FilterUtils::TaskPredicate &predicate : predicates) {
+        checkKernels(store, predicate, 0, slots);
+        checkKernels(store, predicate, 64, 64 + 37);  // Shorter than one step
+        checkKernels(store, predicate, 128, slots - 5); // Ragged tail
+    }
+    
+    std::cout << "✓ Column kernel tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running ColumnFilter unit tests...\n" << std::endl;
+    
+    testKernels();
+    
+    std::cout << "\n✓ All ColumnFilter tests passed!" << std::endl;
+    return 0;
+}
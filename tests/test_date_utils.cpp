@@ -1,5 +1,7 @@
 #include <iostream>
 #include <cassert>
+#include <string_view>
+#include <vector>
 #include "../src/date_utils.h"
 
 void testDateValidation() {
@@ -54,6 +56,55 @@ void testDaysInMonth() {
     std::cout << "✓ Days in month tests passed!" << std::endl;
 }
 
+void testFixedWidthParsing() {
+    std::cout << "Testing fixed-width date parsing..." << std::endl;
+    
+    static_assert(DateUtils::isValidDate(2025, 6, 15)); // Usable at compile time
+    
+    int year = 0, month = 0, day = 0;
+    assert(DateUtils::parseDate("2025-06-15", year, month, day));
+    assert(year == 2025 && month == 6 && day == 15);
+    assert(!DateUtils::parseDate("2025-6-15", year, month, day));
+    assert(!DateUtils::parseDate("2025-06-1a", year, month, day));
+    assert(!DateUtils::parseDate("2025-06-15 ", year, month, day));
+    
+    // The column converter agrees with the scalar one on every entry
+    std::vector<std::string_view> dates = {"2025-06-15", "", "2025-02-29", "2025/06/15", "2024-02-29"};
+    std::vector<int32_t> days(dates.size());
+    assert(DateUtils::toDayNumbers(dates, days) == 2);
+    for (size_t i = 0; i < dates.size(); ++i) {
+        assert(days[i] == DateUtils::toDayNumber(dates[i]));
+    }
+    assert(days[1] == DateUtils::NO_DATE);
+    
+    std::cout << "✓ Fixed-width parsing tests passed!" << std::endl;
+}
+
+void testCalendarArithmetic() {
+    std::cout << "Testing calendar arithmetic..." << std::endl;
+    
+    // Month and year boundaries are exact
+    assert(DateUtils::daysBetween("2025-01-31", "2025-02-01") == 1);
+    assert(DateUtils::daysBetween("2024-02-28", "2024-03-01") == 2);
+    assert(DateUtils::daysBetween("2025-02-28", "2025-03-01") == 1);
+    assert(DateUtils::daysBetween("2024-12-31", "2025-01-01") == 1);
+    assert(DateUtils::daysBetween("2025-06-15", "2025-06-01") == -14);
+    assert(DateUtils::isDateBefore("2025-01-31", "2025-02-01") == true);
+    
+    assert(DateUtils::addDays("2025-06-15", 20) == "2025-07-05");
+    assert(DateUtils::addDays("2025-03-01", -1) == "2025-02-28");
+    assert(DateUtils::addDays("2000-01-01", 36524) == "2099-12-31");
+    
+    assert(DateUtils::isDateInRange("2025-02-01", "2025-01-31", "2025-02-01") == true);
+    assert(DateUtils::isDateInRange("2025-02-02", "2025-01-31", "2025-02-01") == false);
+    
+    int year = 0, month = 0, day = 0;
+    DateUtils::fromDayNumber(DateUtils::toDayNumber(2024, 2, 29) + 366, year, month, day);
+    assert(year == 2025 && month == 3 && day == 1);
+    
+    std::cout << "✓ Calendar arithmetic tests passed!" << std::endl;
+}
+
 int main() {
     std::cout << "Running DateUtils unit tests...\n" << std::endl;
     
@@ -61,6 +112,8 @@ int main() {
     testDateComparisons();
     testLeapYear();
     testDaysInMonth();
+    testFixedWidthParsing();
+    testCalendarArithmetic();
     
     std::cout << "\n✓ All DateUtils tests passed!" << std::endl;
     return 0;
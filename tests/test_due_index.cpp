@@ -0,0 +1,58 @@
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include "../src/due_index.h"
+
+void testRanges()
+{
+    std::cout << "Testing due index ranges..." << std::endl;
+
+    DueIndex index;
+    index.assign({{20, 3}, {10, 1}, {15, 2}, {10, 4}});
+    assert(index.size() == 4);
+
+    auto range = index.range(10, 15);
+    assert(range.size() == 3);
+    assert(range[0].day == 10 && range[0].id == 1);
+    assert(range[1].day == 10 && range[1].id == 4);
+    assert(range[2].day == 15 && range[2].id == 2);
+
+    assert(index.countInRange(16, 19) == 0);
+    assert(index.countInRange(20, 20) == 1);
+    assert(index.range(15, 10).empty()); // Inverted range
+
+    std::cout << "✓ Due index range tests passed!" << std::endl;
+}
+
+void testMutation()
+{
+    std::cout << "Testing due index maintenance..." << std::endl;
+
+    DueIndex index;
+    index.insert(5, 1);
+    index.insert(3, 2);
+    index.insert(5, 1); // Duplicate ignored
+    assert(index.size() == 2);
+    assert(index.range(0, 4)[0].id == 2);
+
+    // Rescheduling is an erase plus an insert
+    index.erase(5, 1);
+    index.insert(2, 1);
+    assert(index.countInRange(5, 5) == 0);
+    assert(index.range(0, 10)[0].id == 1);
+
+    index.erase(9, 9); // Absent entries are ignored
+    assert(index.size() == 2);
+
+    std::cout << "✓ Due index maintenance tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running DueIndex unit tests...\n" << std::endl;
+    
+    testRanges();
+    testMutation();
+    
+    std::cout << "\n✓ All DueIndex tests passed!" << std::endl;
+    return 0;
+}
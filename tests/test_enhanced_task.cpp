@@ -50,22 +50,52 @@ void testTaskUtilities() {
     Task taskDueToday(1, "Due today", "medium", today);
     assert(taskDueToday.isDueToday() == true);
     
-    // Test keyword matching
+    // Test keyword matching (substrings, so "grocer" matches but "grocery" does not)
     Task task(2, "Buy groceries at the store", "medium");
-    assert(task.matchesKeyword("grocery") == true);
-    assert(task.matchesKeyword("GROCERY") == true); // Case insensitive
+    assert(task.matchesKeyword("grocer") == true);
+    assert(task.matchesKeyword("GROCERIES") == true); // Case insensitive
+    assert(task.matchesKeyword("grocery") == false);
     assert(task.matchesKeyword("store") == true);
     assert(task.matchesKeyword("xyz") == false);
     
     std::cout << "✓ Task utility tests passed!" << std::endl;
 }
 
+void testCompactRepresentation() {
+    std::cout << "Testing compact Task representation..." << std::endl;
+    
+    // Only the description lives on the heap
+    assert(sizeof(Task) <= sizeof(std::string) + 16);
+    
+    Task task(1, "Compact", "high", "2025-06-15", "2025-01-01");
+    assert(task.getPriorityCode() == TaskPriority::High);
+    assert(task.getStatusCode() == TaskStatus::Pending);
+    assert(task.getDueDay() == DateUtils::toDayNumber(2025, 6, 15));
+    assert(task.getDueDate() == "2025-06-15");
+    assert(task.getCreatedDate() == "2025-01-01");
+    
+    task.setStatus("in_progress");
+    assert(task.getStatusCode() == TaskStatus::InProgress);
+    assert(task.getStatus() == "in_progress");
+    
+    task.setDueDate("");
+    assert(!task.hasDueDate());
+    assert(task.getDueDate().empty());
+    
+    // Enum order matches the natural order used for sorting
+    assert(TaskPriority::Low < TaskPriority::Medium && TaskPriority::Medium < TaskPriority::High);
+    assert(TaskStatus::Pending < TaskStatus::InProgress && TaskStatus::InProgress < TaskStatus::Done);
+    
+    std::cout << "✓ Compact representation tests passed!" << std::endl;
+}
+
 int main() {
     std::cout << "Running Enhanced Task unit tests...\n" << std::endl;
     
     testEnhancedTaskCreation();
     testTaskValidations();
     testTaskUtilities();
+    testCompactRepresentation();
     
     std::cout << "\n✓ All Enhanced Task tests passed!" << std::endl;
     return 0;
@@ -36,8 +36,10 @@ void testKeywordFiltering()
     tasks.emplace_back(3, "Schedule doctor appointment", "low");
     tasks.emplace_back(4, "Grocery shopping list", "medium");
 
-    auto groceryTasks = FilterUtils::filterByKeyword(tasks, "grocery");
-    assert(groceryTasks.size() == 2); // Case insensitive matching
+    // Case-insensitive substring matching: "grocer" is in "groceries" and "Grocery"
+    auto groceryTasks = FilterUtils::filterByKeyword(tasks, "grocer");
+    assert(groceryTasks.size() == 2);
+    assert(FilterUtils::filterByKeyword(tasks, "grocery").size() == 1);
 
     auto meetingTasks = FilterUtils::filterByKeyword(tasks, "meeting");
     assert(meetingTasks.size() == 1);
@@ -87,6 +89,248 @@ void testCombinedFiltering()
     std::cout << "✓ Combined filtering tests passed!" << std::endl;
 }
 
+void testViewFiltering()
+{
+    std::cout << "Testing zero-copy view filtering..." << std::endl;
+
+    std::vector<Task> tasks;
+    tasks.emplace_back(1, "Write meeting notes", "high");
+    tasks.emplace_back(2, "Buy groceries", "low");
+    tasks.emplace_back(3, "Plan MEETING agenda", "high");
+
+    TaskView view = FilterUtils::viewOf(tasks);
+    TaskView meetings = FilterUtils::filterByKeyword(view, "meeting");
+    assert(meetings.size() == 2);
+    assert(meetings[0] == &tasks[0]); // Points into the input, no copies
+    assert(meetings[1] == &tasks[2]);
+
+    TaskView sorted = FilterUtils::filterAndSort(view, "id", false, "", "high");
+    assert(sorted.size() == 2);
+    assert(sorted[0]->getId() == 3);
+    assert(sorted[1]->getId() == 1);
+
+    std::vector<Task> copies = FilterUtils::materialize(sorted);
+    assert(copies.size() == 2);
+    assert(copies[0].getId() == 3);
+
+    std::cout << "✓ View filtering tests passed!" << std::endl;
+}
+
+void testCompiledCriteria()
+{
+    std::cout << "Testing compiled filter criteria..." << std::endl;
+
+    std::vector<Task> tasks;
+    tasks.emplace_back(1, "Write Report", "high", "2020-01-01");
+    tasks.emplace_back(2, "Read report", "low", "2020-01-01");
+    tasks.emplace_back(3, "Write code", "high");
+    tasks[1].setStatus("done");
+
+    FilterUtils::TaskPredicate predicate = FilterUtils::compileCriteria("REPORT", "", "pending", "", true);
+    assert(predicate.matches(tasks[0]));
+    assert(!predicate.matches(tasks[1])); // Status rejects before the keyword is searched
+    assert(!predicate.matches(tasks[2]));
+
+    TaskView matched = FilterUtils::filterByCriteria(FilterUtils::viewOf(tasks), predicate);
+    assert(matched.size() == 1);
+    assert(matched[0] == &tasks[0]);
+
+    // Unparseable criteria match nothing rather than being ignored
+    assert(FilterUtils::compileCriteria("", "urgent").match_none);
+    assert(FilterUtils::compileCriteria("", "", "", "not-a-date").match_none);
+    assert(FilterUtils::filterByCriteria(FilterUtils::viewOf(tasks), "", "", "blocked").empty());
+
+    std::cout << "✓ Compiled criteria tests passed!" << std::endl;
+}
+
+void testFrozenClock()
+{
+    std::cout << "Testing query context evaluation..." << std::endl;
+
+    std::vector<Task> tasks;
+    tasks.emplace_back(1, "Pay rent", "high", "2025-06-01");
+    tasks.emplace_back(2, "File taxes", "high", "2025-06-15");
+    tasks.emplace_back(3, "No deadline", "low");
+
+    // Filters evaluate against the context's day, not the wall clock
+    QueryContext context{DateUtils::toDayNumber("2025-06-15")};
+    TaskView view = FilterUtils::viewOf(tasks);
+
+    TaskView overdue = FilterUtils::filterOverdue(view, context);
+    assert(overdue.size() == 1 && overdue[0]->getId() == 1);
+
+    TaskView dueToday = FilterUtils::filterDueToday(view, context);
+    assert(dueToday.size() == 1 && dueToday[0]->getId() == 2);
+
+    FilterUtils::TaskPredicate predicate = FilterUtils::compileCriteria(context, "", "high", "", "", true);
+    assert(FilterUtils::filterByCriteria(view, predicate).size() == 1);
+
+    assert(tasks[0].getDaysUntilDue(context.today) == -14);
+    assert(tasks[1].isDueToday(context.today));
+
+    std::cout << "✓ Query context tests passed!" << std::endl;
+}
+
+void testLargeSorts()
+{
+    std::cout << "Testing key-based sorting on large inputs..." << std::endl;
+
+    // Big enough to take the radix path
+    std::vector<Task> tasks;
+    for (int i = 1; i <= 1000; ++i)
+    {
+        int32_t due = (i % 7 == 0) ? DateUtils::NO_DATE : DateUtils::toDayNumber(2025, 1, 1) + (i * 37) % 400 - 200;
+        TaskPriority priority = static_cast<TaskPriority>(i % 3);
+        tasks.emplace_back(i, "Task " + std::to_string(i), TaskStatus::Pending, priority, due, 0);
+    }
+    TaskView view = FilterUtils::viewOf(tasks);
+
+    for (bool ascending : {true, false})
+    {
+        TaskView byDue = FilterUtils::sortByDueDate(view, ascending);
+        assert(byDue.size() == tasks.size());
+        for (size_t i = 1; i < byDue.size(); ++i)
+        {
+            const Task *a = byDue[i - 1];
+            const Task *b = byDue[i];
+            if (!b->hasDueDate())
+                continue; // Undated tasks come last either way
+            assert(a->hasDueDate());
+            assert(ascending ? a->getDueDay() <= b->getDueDay() : a->getDueDay() >= b->getDueDay());
+        }
+    }
+
+    // Stable: equal priorities keep their input order
+    TaskView byPriority = FilterUtils::sortByPriority(view, false);
+    for (size_t i = 1; i < byPriority.size(); ++i)
+    {
+        const Task *a = byPriority[i - 1];
+        const Task *b = byPriority[i];
+        assert(a->getPriorityCode() >= b->getPriorityCode());
+        if (a->getPriorityCode() == b->getPriorityCode())
+            assert(a->getId() < b->getId());
+    }
+
+    TaskView byId = FilterUtils::sortById(view, false);
+    assert(byId.front()->getId() == 1000 && byId.back()->getId() == 1);
+
+    std::cout << "✓ Large sort tests passed!" << std::endl;
+}
+
+void testCompositeSort()
+{
+    std::cout << "Testing composite sort keys..." << std::endl;
+
+    std::vector<Task> tasks;
+    tasks.emplace_back(1, "a", "low", "2025-06-01");
+    tasks.emplace_back(2, "b", "high", "2025-06-10");
+    tasks.emplace_back(3, "c", "high");
+    tasks.emplace_back(4, "d", "high", "2025-06-05");
+    tasks.emplace_back(5, "e", "low", "2025-06-01");
+
+    std::vector<FilterUtils::SortKey> keys;
+    assert(FilterUtils::parseSortSpec("priority:desc,due:asc", true, keys));
+    assert(keys.size() == 3); // ID tiebreak appended
+    assert(keys[2].field == FilterUtils::SortField::Id && keys[2].ascending);
+
+    TaskView sorted = FilterUtils::sortByKeys(FilterUtils::viewOf(tasks), keys);
+    int expected[] = {4, 2, 3, 1, 5}; // Undated last within high; 1 before 5 by ID
+    for (size_t i = 0; i < sorted.size(); ++i)
+    {
+        assert(sorted[i]->getId() == expected[i]);
+    }
+
+    // Direction from the command applies to keys without one
+    sorted = FilterUtils::sortBy(FilterUtils::viewOf(tasks), "due,id:desc", false);
+    assert(sorted[0]->getId() == 2 && sorted[2]->getId() == 5 && sorted[3]->getId() == 1);
+    assert(sorted[4]->getId() == 3);
+
+    assert(FilterUtils::isValidSortSpec("status,created_date:desc"));
+    assert(!FilterUtils::isValidSortSpec("priority:up"));
+    assert(!FilterUtils::isValidSortSpec("priority,"));
+
+    std::cout << "✓ Composite sort tests passed!" << std::endl;
+}
+
+void testTopKAndPagination()
+{
+    std::cout << "Testing top-k and pagination..." << std::endl;
+
+    std::vector<Task> tasks;
+    for (int i = 1; i <= 1000; ++i)
+    {
+        int32_t due = (i % 7 == 0) ? DateUtils::NO_DATE : DateUtils::toDayNumber(2025, 1, 1) + (i * 37) % 400 - 200;
+        TaskPriority priority = static_cast<TaskPriority>(i % 3);
+        tasks.emplace_back(i, "Task " + std::to_string(i), TaskStatus::Pending, priority, due, 0);
+    }
+    TaskView view = FilterUtils::viewOf(tasks);
+
+    std::vector<FilterUtils::SortKey> keys;
+    assert(FilterUtils::parseSortSpec("priority:desc,due", true, keys));
+    TaskView full = FilterUtils::sortByKeys(view, keys);
+
+    // Heap path (small k) and full-sort path agree with the full order
+    for (size_t k : {0, 1, 20, 500, 2000})
+    {
+        TaskView top = FilterUtils::sortTopK(view, keys, k);
+        assert(top.size() == std::min(k, full.size()));
+        for (size_t i = 0; i < top.size(); ++i)
+        {
+            assert(top[i] == full[i]);
+        }
+    }
+
+    // Following cursors visits every task once, in order
+    FilterUtils::PageRequest page;
+    page.limit = 64;
+    size_t seen = 0;
+    while (true)
+    {
+        FilterUtils::TaskPage result;
+        assert(FilterUtils::paginate(view, keys, page, result));
+        for (const Task *task : result.tasks)
+        {
+            assert(task == full[seen++]);
+        }
+        if (!result.has_more)
+            break;
+        page.after = result.next_cursor;
+    }
+    assert(seen == full.size());
+
+    // Offsets, and a cursor whose row has since gone away
+    FilterUtils::PageRequest offsetPage;
+    offsetPage.offset = 990;
+    offsetPage.limit = 20;
+    FilterUtils::TaskPage tail;
+    assert(FilterUtils::paginate(view, keys, offsetPage, tail));
+    assert(tail.tasks.size() == 10 && !tail.has_more && tail.tasks[0] == full[990]);
+
+    FilterUtils::PageRequest afterPage;
+    afterPage.limit = 5;
+    afterPage.after = FilterUtils::makeCursor(*full[100], keys);
+    TaskView rest(full.begin() + 101, full.end());
+    rest.erase(rest.begin()); // full[101] removed
+    FilterUtils::TaskPage resumed;
+    assert(FilterUtils::paginate(rest, keys, afterPage, resumed));
+    assert(resumed.tasks[0] == full[102]);
+
+    // Without keys, pages are in ID order
+    FilterUtils::PageRequest idPage{0, 3, "10"};
+    FilterUtils::TaskPage byId;
+    assert(FilterUtils::paginate(view, {}, idPage, byId));
+    assert(byId.tasks.size() == 3 && byId.tasks[0]->getId() == 11 && byId.next_cursor == "13");
+
+    // Cursors must match the sort keys
+    FilterUtils::PageRequest bad;
+    bad.after = "2.5";
+    assert(!FilterUtils::paginate(view, keys, bad, byId));
+    bad.after = "x.5.5";
+    assert(!FilterUtils::paginate(view, keys, bad, byId));
+
+    std::cout << "✓ Top-k and pagination tests passed!" << std::endl;
+}
+
 void testValidation()
 {
     std::cout << "Testing validation functions..." << std::endl;
@@ -112,6 +356,12 @@ int main()
     testKeywordFiltering();
     testSorting();
     testCombinedFiltering();
+    testViewFiltering();
+    testCompiledCriteria();
+    testFrozenClock();
+    testLargeSorts();
+    testCompositeSort();
+    testTopKAndPagination();
     testValidation();
 
     std::cout << "\n✓ All FilterUtils tests passed!" << std::endl;
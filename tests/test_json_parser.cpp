@@ -3,6 +3,14 @@
 #include "../src/json_parser.h"
 #include "../src/task.h"
 
+// The constructor's third argument is the priority, so statuses are set afterwards
+Task makeTask(int id, const std::string &description, const std::string &status)
+{
+    Task task(id, description);
+    task.setStatus(status);
+    return task;
+}
+
 void testJSONEscaping() {
     std::cout << "Testing JSON escaping..." << std::endl;
     
@@ -19,8 +27,8 @@ void testJSONSerialization() {
     std::cout << "Testing JSON serialization..." << std::endl;
     
     std::vector<Task> tasks;
-    tasks.emplace_back(1, "Test task 1", "pending");
-    tasks.emplace_back(2, "Test task 2", "done");
+    tasks.push_back(makeTask(1, "Test task 1", "pending"));
+    tasks.push_back(makeTask(2, "Test task 2", "done"));
     
     std::string json = JSONParser::tasksToJSON(tasks);
     
@@ -68,9 +76,9 @@ void testRoundTripSerialization() {
     std::cout << "Testing round-trip serialization..." << std::endl;
     
     std::vector<Task> originalTasks;
-    originalTasks.emplace_back(1, "Buy groceries", "pending");
-    originalTasks.emplace_back(2, "Write report", "in_progress");
-    originalTasks.emplace_back(3, "Call client", "done");
+    originalTasks.push_back(makeTask(1, "Buy groceries", "pending"));
+    originalTasks.push_back(makeTask(2, "Write report", "in_progress"));
+    originalTasks.push_back(makeTask(3, "Call client", "done"));
     
     std::string json = JSONParser::tasksToJSON(originalTasks);
     std::vector<Task> parsedTasks = JSONParser::parseTasksFromJSON(json);
@@ -85,6 +93,74 @@ void testRoundTripSerialization() {
     std::cout << "✓ Round-trip serialization tests passed!" << std::endl;
 }
 
+void testTokenizerEdgeCases() {
+    std::cout << "Testing tokenizer edge cases..." << std::endl;
+    
+    // Braces and escaped quotes inside strings, arbitrary field order, unknown fields
+    std::string json = R"([
+  {"status": "done", "extra": {"nested": [1, 2, "}"]}, "description": "Fix {braces} and \"quotes\"", "id": 7},
+  {"id": 8, "priority": "high", "description": "Tab\there \u00e9"}
+])";
+    
+    std::vector<Task> tasks = JSONParser::parseTasksFromJSON(json);
+    
+    assert(tasks.size() == 2);
+    assert(tasks[0].getId() == 7);
+    assert(tasks[0].getStatus() == "done");
+    assert(tasks[0].getDescription() == "Fix {braces} and \"quotes\"");
+    assert(tasks[1].getId() == 8);
+    assert(tasks[1].getPriority() == "high");
+    assert(tasks[1].getDescription() == "Tab\there \xc3\xa9");
+    
+    // Descriptions with special characters survive a round trip
+    std::vector<Task> original;
+    original.emplace_back(1, "Quote \" brace } backslash \\ bell \a", "low");
+    std::vector<Task> parsed = JSONParser::parseTasksFromJSON(JSONParser::tasksToJSON(original));
+    assert(parsed.size() == 1);
+    assert(parsed[0].getDescription() == original[0].getDescription());
+    
+    std::cout << "✓ Tokenizer edge case tests passed!" << std::endl;
+}
+
+void testMalformedInput() {
+    std::cout << "Testing malformed input..." << std::endl;
+    
+    // A bad object fails the whole parse; what came before it is still returned
+    std::vector<Task> tasks;
+    assert(!JSONParser::parseTasksFromJSON(R"([{"id": 1, "description": "Kept"}, {"id": 2, "description": }])", tasks));
+    assert(tasks.size() == 1 && tasks[0].getId() == 1);
+    
+    assert(!JSONParser::parseTasksFromJSON(R"([{"id": 1, "description": "No closing bracket"})", tasks));
+    assert(!JSONParser::parseTasksFromJSON(R"([{"id": 1, "description": "Trailing"}] junk)", tasks));
+    assert(!JSONParser::parseTasksFromJSON(R"([{"id": 1, "description": ""}])", tasks));
+    assert(!JSONParser::parseTasksFromJSON("{}", tasks));
+    
+    // Digit runs past long long saturate instead of overflowing, and are rejected as IDs
+    assert(!JSONParser::parseTasksFromJSON(R"([{"id": 99999999999999999999999999, "description": "Huge"}])", tasks));
+    Task task;
+    assert(!JSONParser::parseTaskObject(R"({"id": 4294967297, "description": "Wraps"})", task));
+    
+    assert(JSONParser::parseTasksFromJSON(" [ ] ", tasks) && tasks.empty());
+    assert(JSONParser::parseTasksFromJSON("", tasks) && tasks.empty());
+    
+    std::cout << "✓ Malformed input tests passed!" << std::endl;
+}
+
+void testSurrogatePairs() {
+    std::cout << "Testing \\u surrogate pairs..." << std::endl;
+    
+    // U+1F600 is one 4-byte UTF-8 sequence, not two 3-byte halves (CESU-8)
+    std::vector<Task> tasks;
+    assert(JSONParser::parseTasksFromJSON(R"([{"id": 1, "description": "smile \ud83d\ude00!"}])", tasks));
+    assert(tasks[0].getDescription() == "smile \xf0\x9f\x98\x80!");
+    
+    // Unpaired halves become U+FFFD
+    assert(JSONParser::parseTasksFromJSON(R"([{"id": 1, "description": "\ud83dx \ude00"}])", tasks));
+    assert(tasks[0].getDescription() == "\xef\xbf\xbdx \xef\xbf\xbd");
+    
+    std::cout << "✓ Surrogate pair tests passed!" << std::endl;
+}
+
 int main() {
     std::cout << "Running JSONParser unit tests...\n" << std::endl;
     
@@ -92,6 +168,9 @@ int main() {
     testJSONSerialization();
     testJSONDeserialization();
     testRoundTripSerialization();
+    testTokenizerEdgeCases();
+    testMalformedInput();
+    testSurrogatePairs();
     
     std::cout << "\n✓ All JSONParser tests passed!" << std::endl;
     return 0;
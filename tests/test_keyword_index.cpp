@@ -0,0 +1,64 @@
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include "../src/keyword_index.h"
+
+void testCandidates()
+{
+    std::cout << "Testing keyword index candidates..." << std::endl;
+
+    KeywordIndex index;
+    index.add(1, "Write Meeting notes");
+    index.add(2, "Buy groceries");
+    index.add(3, "Plan MEETING agenda");
+
+    std::vector<int> ids;
+    assert(index.candidates("meeting", ids));
+    assert(ids.size() == 2);
+    assert(ids[0] == 1 && ids[1] == 3);
+
+    assert(index.candidates("xyz", ids));
+    assert(ids.empty());
+
+    // Too short for a trigram: the caller has to scan
+    assert(!index.candidates("me", ids));
+
+    std::cout << "✓ Keyword index candidate tests passed!" << std::endl;
+}
+
+void testIncrementalUpdates()
+{
+    std::cout << "Testing incremental index maintenance..." << std::endl;
+
+    KeywordIndex index;
+    index.add(5, "Quarterly report");
+    index.add(2, "Annual report"); // Out-of-order IDs stay sorted
+
+    std::vector<int> ids;
+    index.candidates("report", ids);
+    assert(ids.size() == 2);
+    assert(ids[0] == 2 && ids[1] == 5);
+
+    index.remove(5, "Quarterly report");
+    index.add(5, "Quarterly review");
+    index.candidates("report", ids);
+    assert(ids.size() == 1 && ids[0] == 2);
+    index.candidates("review", ids);
+    assert(ids.size() == 1 && ids[0] == 5);
+
+    index.remove(2, "Annual report");
+    index.candidates("report", ids);
+    assert(ids.empty());
+
+    std::cout << "✓ Incremental index tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running KeywordIndex unit tests...\n" << std::endl;
+    
+    testCandidates();
+    testIncrementalUpdates();
+    
+    std::cout << "\n✓ All KeywordIndex tests passed!" << std::endl;
+    return 0;
+}
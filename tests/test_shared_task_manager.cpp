@@ -0,0 +1,180 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cassert>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/shared_task_manager.h"
+#include "../src/date_utils.h"
+
+// Configure with -DTASK_TRACKER_SANITIZER=thread to check the read/write
+// protocol for races (see README)
+const std::string TEST_FILE = "test_shared_tasks.json";
+const int WRITERS = 2;
+const int READERS = 4;
+const int TASKS_PER_WRITER = 100;
+
+void removeTestFiles()
+{
+    std::remove(TEST_FILE.c_str());
+    std::remove((TEST_FILE + ".journal").c_str());
+}
+
+// Everything a reader sees must be one consistent version
+size_t checkSnapshot(const TaskManager &manager, const QueryContext &context)
+{
+    TaskView all = manager.viewAllTasks();
+    TaskCounts counts = manager.countTasks(context);
+    assert(all.size() == counts.total);
+    assert(counts.byStatus[0] + counts.byStatus[1] + counts.byStatus[2] == counts.total);
+    assert(manager.getStats().getTotal() == counts.total);
+    
+    for (const Task *task : all) {
+        assert(manager.findTaskById(task->getId()) == task);
+    }
+    
+    for (const Task *task : manager.viewTasksByKeyword("writer")) {
+        assert(task->getDescription().find("writer") != std::string::npos);
+    }
+    
+    FilterUtils::TaskPredicate done = FilterUtils::compileCriteria(context, "", "", "done");
+    assert(manager.countTasksMatching(done) == manager.viewTasksMatching(done).size());
+    return all.size();
+}
+
+void testConcurrentReadersAndWriters() {
+    std::cout << "Testing snapshot reads during writes..." << std::endl;
+    
+    removeTestFiles();
+    QueryContext context{DateUtils::toDayNumber(2025, 6, 15)};
+    std::ostringstream sink;
+    std::streambuf *savedOut = std::cout.rdbuf(sink.rdbuf());
+    
+    size_t expected = 0;
+    {
+        SharedTaskManager manager(TEST_FILE);
+        std::atomic<int> writersLeft{WRITERS};
+        std::atomic<size_t> reads{0};
+        
+        std::vector<std::thread> threads;
+        for (int w = 0; w < WRITERS; ++w) {
+            threads.emplace_back([&manager, &writersLeft, w] {
+                for (int i = 0; i < TASKS_PER_WRITER; ++i) {
+                    std::string due = DateUtils::formatDayNumber(DateUtils::toDayNumber(2025, 6, 1) + i % 30);
+                    int id = manager.addTask("writer " + std::to_string(w) + " task " + std::to_string(i), "high", due);
+                    assert(id > 0);
+                    assert(manager.updateTask(id, "", i % 2 ? "done" : "in_progress", "low"));
+                    if (i % 3 == 0) {
+                        assert(manager.deleteTask(id));
+                    }
+                }
+                --writersLeft;
+            });
+        }
+        for (int r = 0; r < READERS; ++r) {
+            threads.emplace_back([&manager, &writersLeft, &reads, &context] {
+                while (writersLeft > 0) {
+                    manager.read([&context](const TaskManager &tm) { return checkSnapshot(tm, context); });
+                    ++reads;
+                    std::this_thread::yield(); // Lets a writer through on a single core
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        
+        expected = static_cast<size_t>(WRITERS * (TASKS_PER_WRITER - (TASKS_PER_WRITER + 2) / 3));
+        assert(manager.read([&context](const TaskManager &tm) { return checkSnapshot(tm, context); }) == expected);
+        assert(reads > 0);
+    }
+    
+    // Only the primary journals; a fresh load sees every acknowledged change
+    TaskManager reloaded(TEST_FILE);
+    assert(checkSnapshot(reloaded, context) == expected);
+    assert(reloaded.countTasksByStatus(TaskStatus::Pending) == 0);
+    
+    std::cout.rdbuf(savedOut);
+    removeTestFiles();
+    std::cout << "✓ Snapshot read tests passed!" << std::endl;
+}
+
+std::vector<std::string> listing(const TaskManager &manager)
+{
+    std::vector<std::string> rows;
+    for (const Task *task : manager.viewAllTasks()) {
+        rows.push_back(std::to_string(task->getId()) + task->getDescription() + task->getStatus());
+    }
+    return rows;
+}
+
+// Pins the published replica, starts a write and, while the writer waits for
+// the pin, reads the replica it published instead. Returns both listings.
+void readBothReplicas(SharedTaskManager &manager, std::vector<std::string> &pinnedRows,
+                      std::vector<std::string> &otherRows)
+{
+    std::atomic<bool> pinned{false}, release{false};
+    std::thread reader([&] {
+        manager.read([&](const TaskManager &tm) {
+            pinnedRows = listing(tm);
+            pinned = true;
+            while (!release) {
+                std::this_thread::yield();
+            }
+            assert(listing(tm) == pinnedRows); // Nothing changes under a pin
+            return 0;
+        });
+    });
+    while (!pinned) {
+        std::this_thread::yield();
+    }
+    
+    std::thread writer([&] { manager.addTask("Late task"); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    
+    // Never blocks, and cannot see the write that is waiting on our pin
+    otherRows = manager.read([](const TaskManager &tm) { return listing(tm); });
+    release = true;
+    reader.join();
+    writer.join();
+}
+
+void testMirrorStaysInStep() {
+    std::cout << "Testing that both replicas agree..." << std::endl;
+    
+    removeTestFiles();
+    std::ostringstream sink;
+    std::streambuf *savedOut = std::cout.rdbuf(sink.rdbuf());
+    
+    SharedTaskManager manager(TEST_FILE);
+    for (int i = 0; i < 20; ++i) {
+        manager.addTask("Task " + std::to_string(i), i % 2 ? "high" : "low");
+    }
+    manager.updateTask(4, "Renamed", "done");
+    manager.deleteTask(5);
+    
+    std::vector<std::string> pinnedRows, otherRows;
+    readBothReplicas(manager, pinnedRows, otherRows);
+    assert(pinnedRows.size() == 19 && otherRows == pinnedRows);
+    
+    // The mirror picked up the late task too
+    readBothReplicas(manager, pinnedRows, otherRows);
+    assert(pinnedRows.size() == 20 && otherRows == pinnedRows);
+    
+    std::cout.rdbuf(savedOut);
+    removeTestFiles();
+    std::cout << "✓ Replica tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running SharedTaskManager tests...\n" << std::endl;
+    
+    testConcurrentReadersAndWriters();
+    testMirrorStaysInStep();
+    
+    std::cout << "\n✓ All SharedTaskManager tests passed!" << std::endl;
+    return 0;
+}
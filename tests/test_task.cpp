@@ -11,15 +11,20 @@ void testTaskCreation() {
     assert(task1.getDescription() == "");
     assert(task1.getStatus() == "pending");
     
-    // Test parameterized constructor
-    Task task2(1, "Test task", "in_progress");
+    // Test parameterized constructor (the third argument is the priority;
+    // new tasks always start out pending)
+    Task task2(1, "Test task", "high");
     assert(task2.getId() == 1);
     assert(task2.getDescription() == "Test task");
+    assert(task2.getPriority() == "high");
+    assert(task2.getStatus() == "pending");
+    task2.setStatus("in_progress");
     assert(task2.getStatus() == "in_progress");
     
-    // Test invalid status handling
-    Task task3(2, "Test task", "invalid_status");
-    assert(task3.getStatus() == "pending"); // Should default to pending
+    // Test invalid priority handling
+    Task task3(2, "Test task", "invalid_priority");
+    assert(task3.getPriority() == "medium"); // Should default to medium
+    assert(task3.getStatus() == "pending");
     
     std::cout << "✓ Task creation tests passed!" << std::endl;
 }
@@ -0,0 +1,399 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "../src/task_manager.h"
+#include "../src/date_utils.h"
+#include "../src/binary_snapshot.h"
+
+const std::string TEST_FILE = "test_task_manager_tasks.json";
+
+void removeTestFiles()
+{
+    std::remove(TEST_FILE.c_str());
+    std::remove((TEST_FILE + ".journal").c_str());
+}
+
+// Every counting path has to agree with materializing the matches
+void checkCount(const TaskManager &manager, const FilterUtils::TaskPredicate &predicate)
+{
+    size_t expected = manager.viewTasksMatching(predicate).size();
+    assert(manager.countTasksMatching(predicate) == expected);
+    assert(manager.anyTaskMatching(predicate) == (expected > 0));
+}
+
+// The planned path has to return exactly what a row filter keeps, in store order
+void checkPlan(const TaskManager &manager, const FilterUtils::TaskPredicate &predicate, bool columnScan)
+{
+    assert(manager.prefersColumnScan(predicate) == columnScan);
+    TaskView expected;
+    for (const Task *task : manager.viewAllTasks()) {
+        if (predicate.matches(*task))
+            expected.push_back(task);
+    }
+    assert(manager.viewTasksMatching(predicate) == expected);
+    checkCount(manager, predicate);
+}
+
+void testCounts() {
+    std::cout << "Testing counts without materializing..." << std::endl;
+    
+    removeTestFiles();
+    TaskManager manager(TEST_FILE);
+    QueryContext context{DateUtils::toDayNumber(2025, 6, 15)};
+    
+    const char *priorities[] = {"high", "medium", "low"};
+    for (int i = 0; i < 60; ++i) {
+        std::string due = (i % 4 == 0) ? "" : DateUtils::formatDayNumber(context.today - 10 + i % 20);
+        manager.addTask("Task " + std::to_string(i) + (i % 5 == 0 ? " report" : ""), priorities[i % 3], due);
+    }
+    manager.updateTask(2, "", "done");
+    manager.updateTask(3, "", "in_progress", "high", "2025-06-15");
+    manager.deleteTask(7);
+    manager.deleteTask(8);
+    
+    TaskCounts counts = manager.countTasks(context);
+    assert(counts.total == 58);
+    assert(counts.byStatus[0] + counts.byStatus[1] + counts.byStatus[2] == 58);
+    assert(counts.byStatus[static_cast<size_t>(TaskStatus::Done)] == 1);
+    assert(counts.byPriority[0] + counts.byPriority[1] + counts.byPriority[2] == 58);
+    assert(counts.overdue == manager.viewOverdueTasks(context).size());
+    assert(counts.dueToday == manager.viewTasksDueToday(context).size());
+    assert(manager.countTasksByPriority(TaskPriority::High) ==
+           manager.viewTasksByPriority("high").size());
+    
+    checkCount(manager, FilterUtils::compileCriteria(context));
+    checkCount(manager, FilterUtils::compileCriteria(context, "", "high"));
+    checkCount(manager, FilterUtils::compileCriteria(context, "", "", "pending"));
+    checkCount(manager, FilterUtils::compileCriteria(context, "", "low", "pending"));
+    checkCount(manager, FilterUtils::compileCriteria(context, "", "", "", "", true));
+    checkCount(manager, FilterUtils::compileCriteria(context, "", "high", "in_progress", "", false, true));
+    checkCount(manager, FilterUtils::compileCriteria(context, "", "", "", "2025-06-10"));
+    checkCount(manager, FilterUtils::compileCriteria(context, "report"));
+    checkCount(manager, FilterUtils::compileCriteria(context, "report", "medium", "", "", true));
+    checkCount(manager, FilterUtils::compileCriteria(context, "no such task"));
+    checkCount(manager, FilterUtils::compileCriteria(context, "", "urgent"));
+    
+    removeTestFiles();
+    std::cout << "✓ Count tests passed!" << std::endl;
+}
+
+void testStats() {
+    std::cout << "Testing incrementally maintained stats..." << std::endl;
+    
+    assert(TaskStats::weekStart(DateUtils::toDayNumber(2025, 6, 15)) == DateUtils::toDayNumber(2025, 6, 9));
+    assert(TaskStats::weekStart(DateUtils::toDayNumber(2025, 6, 9)) == DateUtils::toDayNumber(2025, 6, 9));
+    assert(TaskStats::weekStart(0) == DateUtils::toDayNumber(1969, 12, 29));
+    
+    removeTestFiles();
+    TaskManager manager(TEST_FILE);
+    const char *priorities[] = {"high", "medium", "low"};
+    for (int i = 0; i < 40; ++i) {
+        std::string due = (i % 5 == 0) ? "" : DateUtils::formatDayNumber(DateUtils::toDayNumber(2025, 6, 1) + i);
+        manager.addTask("Task " + std::to_string(i), priorities[i % 3], due);
+    }
+    
+    // Status transitions, priority changes and due-date moves
+    manager.updateTask(2, "", "done");
+    manager.updateTask(4, "", "in_progress", "low");
+    manager.updateTask(6, "", "", "", "2025-09-01");
+    manager.updateTask(1, "", "", "", "2025-06-02");
+    manager.deleteTask(10);
+    manager.deleteTask(12);
+    
+    // The maintained counters must match a recount from scratch
+    TaskStats recount;
+    for (const Task *task : manager.viewAllTasks()) {
+        recount.add(*task);
+    }
+    const TaskStats &stats = manager.getStats();
+    assert(stats.getTotal() == recount.getTotal() && stats.getTotal() == 38);
+    assert(stats.countUndated() == recount.countUndated());
+    for (size_t s = 0; s < 3; ++s) {
+        for (size_t p = 0; p < 3; ++p) {
+            TaskStatus status = static_cast<TaskStatus>(s);
+            TaskPriority priority = static_cast<TaskPriority>(p);
+            assert(stats.countByStatusAndPriority(status, priority) ==
+                   recount.countByStatusAndPriority(status, priority));
+        }
+    }
+    assert(stats.getDueWeeks().size() == recount.getDueWeeks().size());
+    for (const auto &[week, counts] : recount.getDueWeeks()) {
+        const TaskStats::WeekCounts &kept = stats.getDueWeeks().at(week);
+        assert(kept.total == counts.total && kept.byStatus == counts.byStatus);
+    }
+    assert(stats.getDueWeeks().count(DateUtils::toDayNumber(2025, 9, 1)) == 1);
+    
+    removeTestFiles();
+    std::cout << "✓ Stats tests passed!" << std::endl;
+}
+
+void testDeferredJournalSync() {
+    std::cout << "Testing group-committed journal writes..." << std::endl;
+    
+    removeTestFiles();
+    {
+        TaskManager manager(TEST_FILE);
+        manager.setDeferredJournalSync(true);
+        manager.addTask("First");
+        manager.addTask("Second");
+        manager.deleteTask(1);
+        assert(manager.hasUnsyncedChanges());
+        
+        // Nothing reaches the disk before the commit
+        assert(TaskManager(TEST_FILE).getTaskCount() == 0);
+        
+        assert(manager.syncJournal());
+        assert(!manager.hasUnsyncedChanges());
+        TaskManager reloaded(TEST_FILE);
+        assert(reloaded.getTaskCount() == 1 && reloaded.findTaskById(2) != nullptr);
+        
+        // Switching back commits whatever is still buffered
+        manager.addTask("Third");
+        manager.setDeferredJournalSync(false);
+        assert(!manager.hasUnsyncedChanges());
+        assert(TaskManager(TEST_FILE).getTaskCount() == 2);
+    }
+    
+    // A failed sync keeps its records for the next attempt
+    removeTestFiles();
+    {
+        TaskManager manager(TEST_FILE);
+        manager.setDeferredJournalSync(true);
+        manager.addTask("Waits for the disk");
+        std::filesystem::create_directory(TEST_FILE + ".journal");
+        assert(!manager.syncJournal());
+        assert(manager.hasUnsyncedChanges());
+        
+        std::filesystem::remove(TEST_FILE + ".journal");
+        manager.addTask("Joins it");
+        assert(manager.setDeferredJournalSync(false));
+        assert(TaskManager(TEST_FILE).getTaskCount() == 2);
+    }
+    removeTestFiles();
+    
+    std::cout << "✓ Group commit tests passed!" << std::endl;
+}
+
+void testFailedCheckpoint() {
+    std::cout << "Testing checkpoints that cannot write the snapshot..." << std::endl;
+    
+    removeTestFiles();
+    const std::string blocker = TEST_FILE + ".tmp";
+    {
+        TaskManager manager(TEST_FILE);
+        manager.addTask("Journaled");
+        manager.addTask("Also journaled");
+        
+        // A directory in the temporary file's place makes the snapshot write fail
+        std::filesystem::create_directory(blocker);
+        assert(!manager.checkpoint());
+        assert(std::filesystem::file_size(TEST_FILE + ".journal") > 0);
+        assert(TaskManager(TEST_FILE).getTaskCount() == 2);
+        
+        // An import that cannot be saved is taken back out
+        std::ofstream(TEST_FILE + ".import") << "[{\"id\": 1, \"description\": \"Imported\"}]";
+        assert(manager.importTasks(TEST_FILE + ".import") == -1);
+        assert(manager.getTaskCount() == 2);
+        
+        std::filesystem::remove(blocker);
+        assert(manager.checkpoint());
+        assert(std::filesystem::file_size(TEST_FILE + ".journal") == 0);
+        assert(manager.addTask("After the checkpoint") == 3);
+    }
+    assert(TaskManager(TEST_FILE).getTaskCount() == 3);
+    std::remove((TEST_FILE + ".import").c_str());
+    removeTestFiles();
+    
+    std::cout << "✓ Failed checkpoint tests passed!" << std::endl;
+}
+
+void testJournalFailures() {
+    std::cout << "Testing mutations the journal cannot record..." << std::endl;
+    
+    removeTestFiles();
+    {
+        TaskManager manager(TEST_FILE);
+        assert(manager.addTask("Recorded") == 1);
+        
+        // A directory in the journal's place makes every append fail
+        std::filesystem::remove(TEST_FILE + ".journal");
+        std::filesystem::create_directory(TEST_FILE + ".journal");
+        assert(manager.addTask("Lost") == 0);
+        assert(!manager.updateTask(1, "Changed"));
+        assert(!manager.deleteTask(1));
+        assert(manager.getTaskCount() == 1);
+        assert(manager.findTaskById(1)->getDescription() == "Recorded");
+        assert(manager.viewTasksByStatus("pending").size() == 1);
+        
+        std::filesystem::remove(TEST_FILE + ".journal");
+        assert(manager.addTask("Recorded later") == 2);
+    }
+    assert(TaskManager(TEST_FILE).getTaskCount() == 1);
+    removeTestFiles();
+    
+    std::cout << "✓ Journal failure tests passed!" << std::endl;
+}
+
+void testTornJournalTail() {
+    std::cout << "Testing appends after a torn journal tail..." << std::endl;
+    
+    removeTestFiles();
+    {
+        TaskManager manager(TEST_FILE);
+        assert(manager.addTask("First") == 1);
+        assert(manager.addTask("Second") == 2);
+    }
+    // A crash in the middle of an append leaves half a record behind
+    std::ofstream(TEST_FILE + ".journal", std::ios::app) << R"(put {"id":3,"descr)";
+    {
+        TaskManager manager(TEST_FILE);
+        assert(manager.getTaskCount() == 2);
+        assert(manager.addTask("Third after crash") == 3);
+    }
+    {
+        TaskManager manager(TEST_FILE);
+        assert(manager.getTaskCount() == 3);
+        const Task *third = manager.findTaskById(3);
+        assert(third != nullptr && third->getDescription() == "Third after crash");
+    }
+    removeTestFiles();
+    
+    std::cout << "✓ Torn journal tail tests passed!" << std::endl;
+}
+
+void testDamagedSnapshot() {
+    std::cout << "Testing stores that cannot be read completely..." << std::endl;
+    
+    removeTestFiles();
+    const std::string damaged = R"([{"id": 1, "description": "Readable"}, {"id": 2, "description": )";
+    std::ofstream(TEST_FILE) << damaged;
+    {
+        // What could be read stays visible, but nothing may overwrite the file
+        TaskManager manager(TEST_FILE);
+        assert(manager.getTaskCount() == 1);
+        assert(manager.addTask("New") == 0);
+        assert(!manager.updateTask(1, "Changed"));
+        assert(!manager.deleteTask(1));
+        assert(!manager.checkpoint());
+    }
+    std::ifstream file(TEST_FILE);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    assert(content == damaged);
+    assert(!std::filesystem::exists(TEST_FILE + ".journal"));
+    removeTestFiles();
+    
+    std::cout << "✓ Damaged snapshot tests passed!" << std::endl;
+}
+
+// Writes a three-task binary store, then overwrites one 4- or 8-byte field in place
+void writeDamagedBinary(const std::string &path, size_t offset, size_t width, uint64_t value)
+{
+    std::vector<Task> tasks = {Task(1, "One"), Task(2, "Two"), Task(3, "Three")};
+    assert(BinarySnapshot::write(path, tasks, 4));
+    uint32_t narrow = static_cast<uint32_t>(value);
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(width == 4 ? reinterpret_cast<const char *>(&narrow) : reinterpret_cast<const char *>(&value), width);
+}
+
+void testDamagedBinarySnapshot() {
+    std::cout << "Testing damaged binary stores..." << std::endl;
+    
+    using BinarySnapshot::Header;
+    using BinarySnapshot::Record;
+    const std::string path = "test_task_manager_tasks.bin";
+    const size_t second = sizeof(Header) + sizeof(Record);
+    struct Damage
+    {
+        size_t offset;
+        size_t width;
+        uint64_t value;
+        size_t readable;
+    };
+    Damage damages[] = {
+        {offsetof(Header, heapSize), 8, UINT64_MAX - 8, 0},                // Would wrap the bounds check
+        {second + offsetof(Record, id), 4, 0, 2},                          // Invalid ID
+        {second + offsetof(Record, id), 4, 1, 2},                          // Duplicate ID
+        {second + offsetof(Record, dueDate), 4, 20251345, 2},              // Month 13
+        {second + offsetof(Record, descriptionOffset), 8, UINT64_MAX, 2},  // Description off the heap
+    };
+    for (const Damage &damage : damages) {
+        // What could be read stays visible, but the file is never overwritten
+        writeDamagedBinary(path, damage.offset, damage.width, damage.value);
+        {
+            TaskManager manager(path);
+            assert(manager.getTaskCount() == damage.readable);
+            assert(manager.addTask("New") == 0);
+            assert(!manager.checkpoint());
+        }
+        assert(!std::filesystem::exists(path + ".journal"));
+    }
+    std::remove(path.c_str());
+    
+    assert(BinarySnapshot::unpackDay(20250230) == DateUtils::NO_DATE);
+    assert(BinarySnapshot::unpackDay(20240229) == DateUtils::toDayNumber(2024, 2, 29));
+    
+    std::cout << "✓ Damaged binary snapshot tests passed!" << std::endl;
+}
+
+void testQueryPlanner() {
+    std::cout << "Testing index walk vs column scan planning..." << std::endl;
+    
+    removeTestFiles();
+    TaskManager manager(TEST_FILE);
+    assert(manager.setDeferredJournalSync(true));
+    QueryContext context{DateUtils::toDayNumber(2025, 6, 15)};
+    
+    // 1280 tasks, so index candidates win only below 10 of them
+    const char *priorities[] = {"high", "medium", "low"};
+    for (int i = 0; i < 1280; ++i) {
+        std::string due = (i % 8 == 0) ? "" : DateUtils::formatDayNumber(context.today - 200 + i % 400);
+        manager.addTask("Task " + std::to_string(i), priorities[i % 3], due);
+    }
+    for (int id = 1; id <= 1280; id += 4) {
+        manager.updateTask(id, "", id % 8 == 1 ? "done" : "in_progress");
+    }
+    for (int id = 5; id <= 1280; id += 50) {
+        manager.deleteTask(id);
+    }
+    
+    // Broad multi-constraint predicates go through the column kernel...
+    checkPlan(manager, FilterUtils::compileCriteria(context), true);
+    checkPlan(manager, FilterUtils::compileCriteria(context, "", "", "pending"), true);
+    checkPlan(manager, FilterUtils::compileCriteria(context, "", "high", "pending"), true);
+    checkPlan(manager, FilterUtils::compileCriteria(context, "", "", "pending", "", true), true);
+    checkPlan(manager, FilterUtils::compileCriteria(context, "", "low", "in_progress", "", true), true);
+    
+    // ...selective ones walk the index candidates
+    checkPlan(manager, FilterUtils::compileCriteria(context, "", "high", "", "", false, true), false);
+    checkPlan(manager, FilterUtils::compileCriteria(context, "", "", "pending", "2025-06-20"), false);
+    checkPlan(manager, FilterUtils::compileCriteria(QueryContext{context.today - 199}, "", "", "", "", true), false);
+    assert(!manager.viewTasksMatching(FilterUtils::compileCriteria(context, "", "", "", "2025-06-20")).empty());
+    
+    assert(manager.setDeferredJournalSync(false));
+    removeTestFiles();
+    
+    std::cout << "✓ Query planner tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running TaskManager unit tests...\n" << std::endl;
+    
+    testCounts();
+    testStats();
+    testQueryPlanner();
+    testDeferredJournalSync();
+    testFailedCheckpoint();
+    testJournalFailures();
+    testTornJournalTail();
+    testDamagedSnapshot();
+    testDamagedBinarySnapshot();
+    
+    std::cout << "\n✓ All TaskManager tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include <iostream>
+#include <cassert>
+#include "../src/task_store.h"
+
+Task makeTask(int id, const std::string &description = "Task")
+{
+    return Task(id, description, TaskStatus::Pending, TaskPriority::Medium, 0, 0);
+}
+
+void testLookup() {
+    std::cout << "Testing lookup by ID..." << std::endl;
+    
+    TaskStore store;
+    for (int id = 1; id <= 100; ++id) {
+        store.put(makeTask(id));
+    }
+    
+    assert(store.size() == 100);
+    assert(store.find(42) != nullptr);
+    assert(store.find(42)->getId() == 42);
+    assert(store.find(101) == nullptr);
+    assert(store.find(0) == nullptr);
+    
+    // Put with an existing ID replaces in place
+    store.put(makeTask(42, "Replaced"));
+    assert(store.size() == 100);
+    assert(store.find(42)->getDescription() == "Replaced");
+    
+    // Far out-of-range IDs still work
+    store.put(makeTask(2000000000, "Far"));
+    assert(store.find(2000000000)->getDescription() == "Far");
+    
+    std::cout << "✓ Lookup tests passed!" << std::endl;
+}
+
+void testDeletionAndCompaction() {
+    std::cout << "Testing deletion and compaction..." << std::endl;
+    
+    TaskStore store;
+    for (int id = 1; id <= 1000; ++id) {
+        store.put(makeTask(id));
+    }
+    
+    assert(store.erase(10));
+    assert(!store.erase(10));
+    assert(store.find(10) == nullptr);
+    assert(store.hasTombstones());
+    
+    // Deleting most tasks triggers compaction; order and lookups survive it
+    for (int id = 11; id <= 900; ++id) {
+        assert(store.erase(id));
+    }
+    assert(store.size() == 109);
+    assert(store.rows().size() < 1000);
+    
+    std::vector<Task> live = store.liveTasks();
+    assert(live.size() == 109);
+    assert(live[0].getId() == 1);
+    assert(live[9].getId() == 901);
+    assert(store.find(950)->getId() == 950);
+    
+    store.compact();
+    assert(!store.hasTombstones());
+    assert(store.rows().size() == 109);
+    assert(store.maxId() == 1000);
+    
+    std::cout << "✓ Deletion and compaction tests passed!" << std::endl;
+}
+
+void testColumns() {
+    std::cout << "Testing column mirrors..." << std::endl;
+    
+    TaskStore store;
+    for (int id = 1; id <= 200; ++id) {
+        TaskPriority priority = static_cast<TaskPriority>(id % 3);
+        store.put(Task(id, "Task " + std::to_string(id), TaskStatus::Pending, priority, 20000 + id, 19000));
+    }
+    
+    // Replacing and deleting keep every column parallel to the rows
+    store.put(Task(5, "Renamed TASK", TaskStatus::Done, TaskPriority::High, 30000, 19000));
+    for (int id = 100; id <= 180; ++id) {
+        store.erase(id);
+    }
+    
+    TaskStore::Columns columns = store.columns();
+    const std::vector<Task> &rows = store.rows();
+    assert(columns.id.size() == rows.size());
+    for (size_t slot = 0; slot < rows.size(); ++slot) {
+        const Task &task = rows[slot];
+        assert(columns.id[slot] == task.getId());
+        if (task.getId() == 0)
+            continue;
+        assert(columns.status[slot] == task.getStatusCode());
+        assert(columns.priority[slot] == task.getPriorityCode());
+        assert(columns.dueDay[slot] == task.getDueDay());
+        assert(columns.createdDay[slot] == task.getCreatedDay());
+    }
+    assert(store.descriptionLower(4) == "renamed task");
+    
+    store.compact();
+    columns = store.columns();
+    assert(columns.id.size() == 119);
+    assert(store.descriptionLower(store.rows().size() - 1) == "task 200");
+    
+    std::cout << "✓ Column mirror tests passed!" << std::endl;
+}
+
+void testDeletedTextReclaimed() {
+    std::cout << "Testing that deleted descriptions are reclaimed..." << std::endl;
+    
+    // A few long descriptions among many short ones, so deleting them leaves
+    // too few tombstones for compaction but mostly stale text
+    TaskStore store;
+    for (int id = 1; id <= 1000; ++id) {
+        store.put(makeTask(id, id <= 100 ? std::string(20000, 'x') : "Short"));
+    }
+    size_t before = store.descriptionTextBytes();
+    assert(before == 100 * 20000 + 900 * 5);
+    for (int id = 1; id <= 100; ++id) {
+        store.erase(id);
+    }
+    assert(store.hasTombstones());
+    assert(store.descriptionTextBytes() < before / 2);
+    assert(store.descriptionLower(store.rows().size() - 1) == "short");
+    
+    std::cout << "✓ Deleted text tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running TaskStore unit tests...\n" << std::endl;
+    
+    testLookup();
+    testDeletionAndCompaction();
+    testColumns();
+    testDeletedTextReclaimed();
+    
+    std::cout << "\n✓ All TaskStore tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,140 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "../src/wire_protocol.h"
+
+using WireProtocol::FrameStatus;
+
+void testRequestRoundTrip() {
+    std::vector<std::string> args = {"add", "Buy milk", "--priority", "high", "", std::string("a\0b", 3)};
+    std::string frame = WireProtocol::encodeRequest(args);
+    
+    size_t offset = 0;
+    std::string_view payload;
+    assert(WireProtocol::takeFrame(frame, offset, payload) == FrameStatus::Complete);
+    assert(offset == frame.size());
+    
+    std::vector<std::string> decoded;
+    assert(WireProtocol::decodeRequest(payload, decoded));
+    assert(decoded == args);
+    
+    // Empty argument list
+    frame = WireProtocol::encodeRequest({});
+    offset = 0;
+    assert(WireProtocol::takeFrame(frame, offset, payload) == FrameStatus::Complete);
+    assert(WireProtocol::decodeRequest(payload, decoded) && decoded.empty());
+    
+    std::cout << "✓ Request round trip tests passed!" << std::endl;
+}
+
+void testResponseRoundTrip() {
+    std::string frame = WireProtocol::encodeResponse("Task added\n", "");
+    size_t offset = 0;
+    std::string_view payload;
+    assert(WireProtocol::takeFrame(frame, offset, payload) == FrameStatus::Complete);
+    
+    std::string out, err;
+    bool more = true;
+    assert(WireProtocol::decodeResponse(payload, out, err, more));
+    assert(out == "Task added\n" && err.empty() && !more);
+    assert(offset == frame.size());
+    
+    std::cout << "✓ Response round trip tests passed!" << std::endl;
+}
+
+void testLargeResponses() {
+    // Output far beyond one frame's limit arrives as a run of parts
+    std::string listing(WireProtocol::MAX_FRAME_BYTES + 3 * WireProtocol::RESPONSE_PART_BYTES / 2, 'x');
+    listing[12345] = 'y';
+    std::string stream = WireProtocol::encodeResponse(listing, "warning\n");
+    
+    size_t offset = 0;
+    size_t parts = 0;
+    std::string_view payload;
+    std::string out, err, joinedOut, joinedErr;
+    bool more = true;
+    while (more) {
+        assert(WireProtocol::takeFrame(stream, offset, payload) == FrameStatus::Complete);
+        assert(payload.size() <= WireProtocol::RESPONSE_PART_BYTES + 3 * WireProtocol::HEADER_BYTES);
+        assert(WireProtocol::decodeResponse(payload, out, err, more));
+        joinedOut += out;
+        joinedErr += err;
+        ++parts;
+    }
+    assert(offset == stream.size());
+    assert(joinedOut == listing && joinedErr == "warning\n");
+    assert(parts == listing.size() / WireProtocol::RESPONSE_PART_BYTES + 1);
+    
+    std::cout << "✓ Large response tests passed!" << std::endl;
+}
+
+void testPartialAndPipelinedFrames() {
+    std::string stream = WireProtocol::encodeRequest({"list"}) + WireProtocol::encodeRequest({"count", "--overdue"});
+    
+    // Every strict prefix of the first frame is incomplete and consumes nothing
+    size_t first = WireProtocol::encodeRequest({"list"}).size();
+    for (size_t cut = 0; cut < first; ++cut) {
+        size_t offset = 0;
+        std::string_view payload;
+        assert(WireProtocol::takeFrame(std::string_view(stream).substr(0, cut), offset, payload) == FrameStatus::Incomplete);
+        assert(offset == 0);
+    }
+    
+    // Two frames in one buffer come out one after the other
+    size_t offset = 0;
+    std::string_view payload;
+    std::vector<std::string> args;
+    assert(WireProtocol::takeFrame(stream, offset, payload) == FrameStatus::Complete);
+    assert(WireProtocol::decodeRequest(payload, args) && args == std::vector<std::string>{"list"});
+    assert(WireProtocol::takeFrame(stream, offset, payload) == FrameStatus::Complete);
+    assert(WireProtocol::decodeRequest(payload, args) && args.size() == 2 && args[1] == "--overdue");
+    assert(offset == stream.size());
+    assert(WireProtocol::takeFrame(stream, offset, payload) == FrameStatus::Incomplete);
+    
+    std::cout << "✓ Partial and pipelined frame tests passed!" << std::endl;
+}
+
+void testMalformedInput() {
+    // Oversized length header
+    std::string huge = "\xff\xff\xff\xff";
+    size_t offset = 0;
+    std::string_view payload;
+    assert(WireProtocol::takeFrame(huge, offset, payload) == FrameStatus::Invalid);
+    
+    // Argument count larger than the payload could hold
+    std::vector<std::string> args;
+    assert(!WireProtocol::decodeRequest(std::string("\x10\x00\x00\x00", 4), args));
+    
+    // Argument length running past the end
+    assert(!WireProtocol::decodeRequest(std::string("\x01\x00\x00\x00\x09\x00\x00\x00" "abc", 11), args));
+    
+    // Trailing bytes after the last argument
+    std::string frame = WireProtocol::encodeRequest({"list"});
+    std::string padded = frame.substr(WireProtocol::HEADER_BYTES) + "x";
+    assert(!WireProtocol::decodeRequest(padded, args));
+    
+    std::string out, err;
+    bool more = false;
+    assert(!WireProtocol::decodeResponse("", out, err, more));
+    
+    // Part flags other than 0 and 1
+    std::string part = WireProtocol::encodeResponse("a", "").substr(WireProtocol::HEADER_BYTES);
+    part[part.size() - WireProtocol::HEADER_BYTES] = 2;
+    assert(!WireProtocol::decodeResponse(part, out, err, more));
+    
+    std::cout << "✓ Malformed input tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running WireProtocol unit tests...\n" << std::endl;
+    
+    testRequestRoundTrip();
+    testResponseRoundTrip();
+    testLargeResponses();
+    testPartialAndPipelinedFrames();
+    testMalformedInput();
+    
+    std::cout << "\n✓ All WireProtocol tests passed!" << std::endl;
+    return 0;
+}